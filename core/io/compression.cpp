@@ -41,11 +41,19 @@
 #include <brotli/decode.h>
 #endif
 
-// Caches for zstd.
-static BinaryMutex mutex;
-static ZSTD_DCtx *current_zstd_d_ctx = nullptr;
-static bool current_zstd_long_distance_matching;
-static int current_zstd_window_log_size;
+// Cache for zstd, one decompression context per thread so that blocks can be decompressed in parallel.
+struct ZstdDecompressionCache {
+	ZSTD_DCtx *ctx = nullptr;
+	bool long_distance_matching = false;
+	int window_log_size = 0;
+
+	~ZstdDecompressionCache() {
+		if (ctx) {
+			ZSTD_freeDCtx(ctx);
+		}
+	}
+};
+static thread_local ZstdDecompressionCache zstd_d_cache;
 
 int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
 	switch (p_mode) {
@@ -198,22 +206,21 @@ int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const ui
 			return total;
 		} break;
 		case MODE_ZSTD: {
-			MutexLock lock(mutex);
-
-			if (!current_zstd_d_ctx || current_zstd_long_distance_matching != zstd_long_distance_matching || current_zstd_window_log_size != zstd_window_log_size) {
-				if (current_zstd_d_ctx) {
-					ZSTD_freeDCtx(current_zstd_d_ctx);
+			ZstdDecompressionCache &cache = zstd_d_cache;
+			if (!cache.ctx || cache.long_distance_matching != zstd_long_distance_matching || cache.window_log_size != zstd_window_log_size) {
+				if (cache.ctx) {
+					ZSTD_freeDCtx(cache.ctx);
 				}
 
-				current_zstd_d_ctx = ZSTD_createDCtx();
+				cache.ctx = ZSTD_createDCtx();
 				if (zstd_long_distance_matching) {
-					ZSTD_DCtx_setParameter(current_zstd_d_ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
+					ZSTD_DCtx_setParameter(cache.ctx, ZSTD_d_windowLogMax, zstd_window_log_size);
 				}
-				current_zstd_long_distance_matching = zstd_long_distance_matching;
-				current_zstd_window_log_size = zstd_window_log_size;
+				cache.long_distance_matching = zstd_long_distance_matching;
+				cache.window_log_size = zstd_window_log_size;
 			}
 
-			size_t ret = ZSTD_decompressDCtx(current_zstd_d_ctx, p_dst, p_dst_max_size, p_src, p_src_size);
+			size_t ret = ZSTD_decompressDCtx(cache.ctx, p_dst, p_dst_max_size, p_src, p_src_size);
 			return (int64_t)ret;
 		} break;
 	}
@@ -369,3 +376,279 @@ int Compression::decompress_dynamic(Vector<uint8_t> *p_dst_vect, int64_t p_max_d
 		return Z_OK;
 	}
 }
+
+/**
+	Builds a raw content dictionary for Zstandard out of sample payloads, to be passed to CompressionStream.
+	Zstandard matches new data against the end of the dictionary first, so the most representative samples should come last.
+	Samples are taken from the end of the list until p_max_size is reached.
+	Dictionaries trained offline with `zstd --train` can be used in the same way and usually compress better.
+*/
+Vector<uint8_t> Compression::create_zstd_raw_dictionary(const Vector<Vector<uint8_t>> &p_samples, int64_t p_max_size) {
+	ERR_FAIL_COND_V(p_max_size <= 0, Vector<uint8_t>());
+
+	int64_t total_size = 0;
+	int first_sample = p_samples.size();
+	while (first_sample > 0 && total_size + p_samples[first_sample - 1].size() <= p_max_size) {
+		first_sample--;
+		total_size += p_samples[first_sample].size();
+	}
+
+	Vector<uint8_t> dictionary;
+	dictionary.resize(total_size);
+	uint8_t *w = dictionary.ptrw();
+	for (int i = first_sample; i < p_samples.size(); i++) {
+		memcpy(w, p_samples[i].ptr(), p_samples[i].size());
+		w += p_samples[i].size();
+	}
+
+	// A dictionary starting with the Zstandard dictionary magic number would be parsed as a trained one.
+	const uint8_t *r = dictionary.ptr();
+	if (total_size >= 4 && (r[0] | (r[1] << 8) | (r[2] << 16) | ((uint32_t)r[3] << 24)) == ZSTD_MAGIC_DICTIONARY) {
+		dictionary.write[0] ^= 0xFF;
+	}
+	return dictionary;
+}
+
+CompressionStream::~CompressionStream() {
+	clear();
+}
+
+void CompressionStream::clear() {
+	if (!ctx) {
+		return;
+	}
+
+	switch (mode) {
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			z_stream *strm = (z_stream *)ctx;
+			if (compressing) {
+				deflateEnd(strm);
+			} else {
+				inflateEnd(strm);
+			}
+			memfree(strm);
+		} break;
+		case Compression::MODE_ZSTD: {
+			if (compressing) {
+				ZSTD_freeCCtx((ZSTD_CCtx *)ctx);
+			} else {
+				ZSTD_freeDCtx((ZSTD_DCtx *)ctx);
+			}
+		} break;
+		case Compression::MODE_BROTLI: {
+#ifdef BROTLI_ENABLED
+			BrotliDecoderDestroyInstance((BrotliDecoderState *)ctx);
+#endif
+		} break;
+		case Compression::MODE_FASTLZ: {
+		} break;
+	}
+	ctx = nullptr;
+	finished = false;
+}
+
+Error CompressionStream::start_compression(Compression::Mode p_mode, const Vector<uint8_t> &p_zstd_dictionary) {
+	return _start(true, p_mode, p_zstd_dictionary);
+}
+
+Error CompressionStream::start_decompression(Compression::Mode p_mode, const Vector<uint8_t> &p_zstd_dictionary) {
+	return _start(false, p_mode, p_zstd_dictionary);
+}
+
+Error CompressionStream::_start(bool p_compress, Compression::Mode p_mode, const Vector<uint8_t> &p_zstd_dictionary) {
+	ERR_FAIL_COND_V(ctx != nullptr, ERR_ALREADY_IN_USE);
+	ERR_FAIL_COND_V_MSG(!p_zstd_dictionary.is_empty() && p_mode != Compression::MODE_ZSTD, ERR_INVALID_PARAMETER, "Dictionaries are only supported in Zstandard mode.");
+
+	mode = p_mode;
+	compressing = p_compress;
+	finished = false;
+
+	switch (p_mode) {
+		case Compression::MODE_FASTLZ: {
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "FastLZ doesn't support streaming. Consider using Zstd instead.");
+		} break;
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			z_stream *strm = (z_stream *)memalloc(sizeof(z_stream));
+			strm->next_in = Z_NULL;
+			strm->avail_in = 0;
+			strm->zalloc = zipio_alloc;
+			strm->zfree = zipio_free;
+			strm->opaque = Z_NULL;
+			const int window_bits = p_mode == Compression::MODE_DEFLATE ? 15 : 15 + 16;
+			int err = Z_OK;
+			if (p_compress) {
+				const int level = p_mode == Compression::MODE_DEFLATE ? Compression::zlib_level : Compression::gzip_level;
+				err = deflateInit2(strm, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+			} else {
+				err = inflateInit2(strm, window_bits);
+			}
+			if (err != Z_OK) {
+				memfree(strm);
+				ERR_FAIL_V(FAILED);
+			}
+			ctx = strm;
+		} break;
+		case Compression::MODE_ZSTD: {
+			if (p_compress) {
+				ZSTD_CCtx *cctx = ZSTD_createCCtx();
+				ERR_FAIL_NULL_V(cctx, ERR_OUT_OF_MEMORY);
+				ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, Compression::zstd_level);
+				if (Compression::zstd_long_distance_matching) {
+					ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
+					ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, Compression::zstd_window_log_size);
+				}
+				if (!p_zstd_dictionary.is_empty() && ZSTD_isError(ZSTD_CCtx_loadDictionary(cctx, p_zstd_dictionary.ptr(), p_zstd_dictionary.size()))) {
+					ZSTD_freeCCtx(cctx);
+					ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid Zstandard dictionary.");
+				}
+				ctx = cctx;
+			} else {
+				ZSTD_DCtx *dctx = ZSTD_createDCtx();
+				ERR_FAIL_NULL_V(dctx, ERR_OUT_OF_MEMORY);
+				if (Compression::zstd_long_distance_matching) {
+					ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, Compression::zstd_window_log_size);
+				}
+				if (!p_zstd_dictionary.is_empty() && ZSTD_isError(ZSTD_DCtx_loadDictionary(dctx, p_zstd_dictionary.ptr(), p_zstd_dictionary.size()))) {
+					ZSTD_freeDCtx(dctx);
+					ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid Zstandard dictionary.");
+				}
+				ctx = dctx;
+			}
+		} break;
+		case Compression::MODE_BROTLI: {
+			ERR_FAIL_COND_V_MSG(p_compress, ERR_UNAVAILABLE, "Only brotli decompression is supported.");
+#ifdef BROTLI_ENABLED
+			BrotliDecoderState *state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+			ERR_FAIL_NULL_V(state, ERR_OUT_OF_MEMORY);
+			ctx = state;
+#else
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Godot was compiled without brotli support.");
+#endif
+		} break;
+	}
+
+	return OK;
+}
+
+Error CompressionStream::reset() {
+	ERR_FAIL_NULL_V(ctx, ERR_UNCONFIGURED);
+
+	switch (mode) {
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			z_stream *strm = (z_stream *)ctx;
+			const int err = compressing ? deflateReset(strm) : inflateReset(strm);
+			ERR_FAIL_COND_V(err != Z_OK, FAILED);
+		} break;
+		case Compression::MODE_ZSTD: {
+			// Resetting the session keeps the parameters and dictionary.
+			const size_t ret = compressing ? ZSTD_CCtx_reset((ZSTD_CCtx *)ctx, ZSTD_reset_session_only) : ZSTD_DCtx_reset((ZSTD_DCtx *)ctx, ZSTD_reset_session_only);
+			ERR_FAIL_COND_V(ZSTD_isError(ret), FAILED);
+		} break;
+		case Compression::MODE_BROTLI: {
+#ifdef BROTLI_ENABLED
+			// Brotli decoders can't be reset, so start over with a new one.
+			BrotliDecoderDestroyInstance((BrotliDecoderState *)ctx);
+			ctx = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+			ERR_FAIL_NULL_V(ctx, ERR_OUT_OF_MEMORY);
+#endif
+		} break;
+		case Compression::MODE_FASTLZ: {
+		} break;
+	}
+
+	finished = false;
+	return OK;
+}
+
+Error CompressionStream::process(const uint8_t *p_src, int64_t p_src_size, int64_t &r_consumed, uint8_t *p_dst, int64_t p_dst_size, int64_t &r_written, bool p_finish) {
+	r_consumed = 0;
+	r_written = 0;
+	ERR_FAIL_NULL_V(ctx, ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_src_size < 0 || p_dst_size < 0, ERR_INVALID_PARAMETER);
+
+	switch (mode) {
+		case Compression::MODE_DEFLATE:
+		case Compression::MODE_GZIP: {
+			// ZLib's implementation uses C++ `unsigned int` for buffer sizes, larger buffers are processed over several calls.
+			z_stream *strm = (z_stream *)ctx;
+			const uInt src_size = MIN(p_src_size, (int64_t)INT32_MAX);
+			const uInt dst_size = MIN(p_dst_size, (int64_t)INT32_MAX);
+			strm->next_in = (Bytef *)p_src;
+			strm->avail_in = src_size;
+			strm->next_out = (Bytef *)p_dst;
+			strm->avail_out = dst_size;
+
+			int err;
+			if (compressing) {
+				// Only finish once all input has been handed to ZLib.
+				err = deflate(strm, p_finish && src_size == p_src_size ? Z_FINISH : Z_NO_FLUSH);
+				ERR_FAIL_COND_V(err == Z_STREAM_ERROR, FAILED);
+			} else {
+				err = inflate(strm, Z_NO_FLUSH);
+				if (err == Z_NEED_DICT || err == Z_DATA_ERROR || err == Z_STREAM_ERROR || err == Z_MEM_ERROR) {
+					if (strm->msg) {
+						WARN_PRINT(strm->msg);
+					}
+					return ERR_FILE_CORRUPT;
+				}
+			}
+			// Z_BUF_ERROR only means no progress could be made with the given buffers.
+			finished = err == Z_STREAM_END;
+			r_consumed = src_size - strm->avail_in;
+			r_written = dst_size - strm->avail_out;
+		} break;
+		case Compression::MODE_ZSTD: {
+			ZSTD_inBuffer in = { p_src, (size_t)p_src_size, 0 };
+			ZSTD_outBuffer out = { p_dst, (size_t)p_dst_size, 0 };
+			size_t ret;
+			if (compressing) {
+				ret = ZSTD_compressStream2((ZSTD_CCtx *)ctx, &out, &in, p_finish ? ZSTD_e_end : ZSTD_e_continue);
+				ERR_FAIL_COND_V_MSG(ZSTD_isError(ret), FAILED, ZSTD_getErrorName(ret));
+				// When ending, zero means the frame has been fully flushed.
+				finished = p_finish && ret == 0;
+			} else {
+				ret = ZSTD_decompressStream((ZSTD_DCtx *)ctx, &out, &in);
+				if (ZSTD_isError(ret)) {
+					WARN_PRINT(ZSTD_getErrorName(ret));
+					return ERR_FILE_CORRUPT;
+				}
+				// Zero means a frame was completely decoded and flushed.
+				finished = ret == 0;
+			}
+			r_consumed = in.pos;
+			r_written = out.pos;
+		} break;
+		case Compression::MODE_BROTLI: {
+#ifdef BROTLI_ENABLED
+			BrotliDecoderState *state = (BrotliDecoderState *)ctx;
+			const uint8_t *next_in = p_src;
+			size_t avail_in = p_src_size;
+			uint8_t *next_out = p_dst;
+			size_t avail_out = p_dst_size;
+			BrotliDecoderResult ret = BrotliDecoderDecompressStream(state, &avail_in, &next_in, &avail_out, &next_out, nullptr);
+			if (ret == BROTLI_DECODER_RESULT_ERROR) {
+				WARN_PRINT(BrotliDecoderErrorString(BrotliDecoderGetErrorCode(state)));
+				return ERR_FILE_CORRUPT;
+			}
+			finished = ret == BROTLI_DECODER_RESULT_SUCCESS;
+			r_consumed = p_src_size - avail_in;
+			r_written = p_dst_size - avail_out;
+#endif
+		} break;
+		case Compression::MODE_FASTLZ: {
+			ERR_FAIL_V(ERR_BUG);
+		} break;
+	}
+
+	return OK;
+}
+
+int64_t CompressionStream::get_recommended_buffer_size(Compression::Mode p_mode, bool p_compress) {
+	if (p_mode == Compression::MODE_ZSTD) {
+		return p_compress ? ZSTD_CStreamOutSize() : ZSTD_DStreamOutSize();
+	}
+	return Compression::gzip_chunk;
+}
@@ -56,4 +56,44 @@ public:
 	static int64_t get_max_compressed_buffer_size(int64_t p_src_size, Mode p_mode = MODE_ZSTD);
 	static int64_t decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
 	static int decompress_dynamic(Vector<uint8_t> *p_dst_vect, int64_t p_max_dst_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode);
+
+	static Vector<uint8_t> create_zstd_raw_dictionary(const Vector<Vector<uint8_t>> &p_samples, int64_t p_max_size = 112640);
+};
+
+// Incremental compression and decompression with bounded memory, for data
+// that doesn't fit (or shouldn't be held) in memory at once.
+// Feed input with process() until it has all been consumed, draining the
+// output buffer each call. When compressing, keep calling process() with
+// p_finish set until is_finished() returns true.
+// Zstandard streams can use a dictionary shared by both sides, which greatly
+// improves the ratio of many small, similar payloads (e.g. network snapshots).
+// reset() keeps the context and dictionary, so one stream can be reused for
+// many small frames without reallocating.
+class CompressionStream {
+	Compression::Mode mode = Compression::MODE_ZSTD;
+	bool compressing = false;
+	bool finished = false;
+	void *ctx = nullptr;
+
+	Error _start(bool p_compress, Compression::Mode p_mode, const Vector<uint8_t> &p_zstd_dictionary);
+
+public:
+	Error start_compression(Compression::Mode p_mode, const Vector<uint8_t> &p_zstd_dictionary = Vector<uint8_t>());
+	Error start_decompression(Compression::Mode p_mode, const Vector<uint8_t> &p_zstd_dictionary = Vector<uint8_t>());
+
+	Error process(const uint8_t *p_src, int64_t p_src_size, int64_t &r_consumed, uint8_t *p_dst, int64_t p_dst_size, int64_t &r_written, bool p_finish = false);
+	Error reset();
+	void clear();
+
+	bool is_active() const { return ctx != nullptr; }
+	bool is_compressing() const { return compressing; }
+	bool is_finished() const { return finished; }
+	Compression::Mode get_mode() const { return mode; }
+
+	static int64_t get_recommended_buffer_size(Compression::Mode p_mode, bool p_compress);
+
+	CompressionStream() {}
+	CompressionStream(const CompressionStream &) = delete;
+	CompressionStream &operator=(const CompressionStream &) = delete;
+	~CompressionStream();
 };
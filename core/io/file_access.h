@@ -35,6 +35,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
 #include "core/string/ustring.h"
+#include "core/templates/span.h"
 #include "core/typedefs.h"
 
 /**
@@ -192,6 +193,7 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual Span<uint8_t> get_mapped_span() const { return Span<uint8_t>(); } ///< get the whole file contents if they are readable straight from memory (e.g. memory-mapped), valid until the file is closed. Empty if unsupported.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
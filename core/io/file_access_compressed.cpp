@@ -30,6 +30,11 @@
 
 #include "file_access_compressed.h"
 
+#include "core/object/worker_thread_pool.h"
+
+// Upper bound for the uncompressed size of a batch of blocks processed in parallel.
+static constexpr uint32_t PARALLEL_BATCH_BYTES = 1024 * 1024;
+
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
@@ -59,20 +64,95 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 		read_blocks.push_back(rb);
 	}
 
+	read_ahead_blocks = MIN(_get_parallel_block_count(), bc);
 	comp_buffer.resize(max_bs);
-	buffer.resize(block_size);
-	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
+	buffer.resize((uint64_t)block_size * read_ahead_blocks);
 	at_end = false;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
-
-	const int64_t ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
+	window_count = 0;
 	read_block = 0;
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	return _load_block(0, false);
+}
+
+void FileAccessCompressed::_process_block_task(void *p_userdata, uint32_t p_index) {
+	const BlockTaskBatch *batch = (const BlockTaskBatch *)p_userdata;
+	BlockTask &task = batch->tasks[p_index];
+	if (batch->compress) {
+		task.result = Compression::compress(task.dst, task.src, task.src_size, batch->mode);
+	} else {
+		task.result = Compression::decompress(task.dst, task.dst_size, task.src, task.src_size, batch->mode);
+	}
+}
+
+void FileAccessCompressed::_run_block_tasks(Compression::Mode p_mode, bool p_compress, BlockTask *p_tasks, uint32_t p_count) {
+	BlockTaskBatch batch;
+	batch.mode = p_mode;
+	batch.compress = p_compress;
+	batch.tasks = p_tasks;
+
+	if (p_count > 1) {
+		WorkerThreadPool::GroupID group_id = WorkerThreadPool::get_singleton()->add_native_group_task(&_process_block_task, &batch, p_count, -1, true, "FileAccessCompressedBlocks");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+	} else {
+		for (uint32_t i = 0; i < p_count; i++) {
+			_process_block_task(&batch, i);
+		}
+	}
+}
+
+uint32_t FileAccessCompressed::_get_parallel_block_count() const {
+	const WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Waiting for a group task from inside the pool could deadlock if all threads do it, so pool threads stay serial.
+	if (!pool || pool->get_thread_count() <= 1 || pool->get_thread_index() != -1 || block_size == 0) {
+		return 1;
+	}
+	return CLAMP(PARALLEL_BATCH_BYTES / block_size, 1u, uint32_t(pool->get_thread_count()) * 4);
+}
+
+Error FileAccessCompressed::_load_block(uint32_t p_block, bool p_read_ahead) const {
+	if (p_block < window_first || p_block >= window_first + window_count) {
+		// Blocks are stored back to back, so the whole window is read at once.
+		const uint32_t count = p_read_ahead ? MIN(MIN(read_ahead_blocks, _get_parallel_block_count()), read_block_count - p_block) : 1;
+		uint64_t comp_size = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			comp_size += read_blocks[p_block + i].csize;
+		}
+		if ((uint64_t)comp_buffer.size() < comp_size) {
+			comp_buffer.resize(comp_size);
+		}
+		f->seek(read_blocks[p_block].offset);
+		f->get_buffer(comp_buffer.ptrw(), comp_size);
+
+		LocalVector<BlockTask> tasks;
+		tasks.resize(count);
+		const uint8_t *src = comp_buffer.ptr();
+		uint8_t *dst = buffer.ptrw();
+		for (uint32_t i = 0; i < count; i++) {
+			tasks[i].src = src;
+			tasks[i].src_size = read_blocks[p_block + i].csize;
+			tasks[i].dst = dst;
+			tasks[i].dst_size = read_block_count == 1 ? read_total : block_size;
+			src += tasks[i].src_size;
+			dst += block_size;
+		}
+		_run_block_tasks(cmode, false, tasks.ptr(), count);
+
+		window_count = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			if (tasks[i].result < 0) {
+				return ERR_FILE_CORRUPT;
+			}
+		}
+		window_first = p_block;
+		window_count = count;
+	}
+
+	read_ptr = buffer.ptrw() + (uint64_t)(p_block - window_first) * block_size;
+	read_block_size = p_block == read_block_count - 1 ? read_total % block_size : block_size;
+	return OK;
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -132,22 +212,32 @@ void FileAccessCompressed::_close() {
 
 		uint32_t last_block_size = write_max % block_size;
 
-		// Temporary buffer for compressed data blocks.
+		// Temporary buffer for compressed data blocks, one slot per block of a batch.
+		const uint32_t batch_size = MIN(_get_parallel_block_count(), bc);
+		const int64_t max_cblock_size = Compression::get_max_compressed_buffer_size(bc == 1 ? last_block_size : block_size, cmode);
 		LocalVector<uint8_t> temp_cblock;
-		temp_cblock.resize(Compression::get_max_compressed_buffer_size(bc == 1 ? last_block_size : block_size, cmode));
-		uint8_t *temp_cblock_ptr = temp_cblock.ptr();
+		temp_cblock.resize(max_cblock_size * batch_size);
+		LocalVector<BlockTask> tasks;
+		tasks.resize(batch_size);
 
-		// Compress and store the blocks.
+		// Compress the blocks in parallel batches, and store them in order.
 		LocalVector<uint32_t> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? last_block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			const int64_t compressed_size = Compression::compress(temp_cblock_ptr, bp, bl, cmode);
-			ERR_FAIL_COND_MSG(compressed_size < 0, "FileAccessCompressed: Error compressing data.");
+		for (uint32_t first = 0; first < bc; first += batch_size) {
+			const uint32_t count = MIN(batch_size, bc - first);
+			for (uint32_t j = 0; j < count; j++) {
+				const uint32_t i = first + j;
+				tasks[j].src = &write_ptr[(uint64_t)i * block_size];
+				tasks[j].src_size = i == (bc - 1) ? last_block_size : block_size;
+				tasks[j].dst = temp_cblock.ptr() + max_cblock_size * j;
+				tasks[j].dst_size = max_cblock_size;
+			}
+			_run_block_tasks(cmode, true, tasks.ptr(), count);
 
-			f->store_buffer(temp_cblock_ptr, (uint64_t)compressed_size);
-			block_sizes.push_back(compressed_size);
+			for (uint32_t j = 0; j < count; j++) {
+				ERR_FAIL_COND_MSG(tasks[j].result < 0, "FileAccessCompressed: Error compressing data.");
+				f->store_buffer(tasks[j].dst, (uint64_t)tasks[j].result);
+				block_sizes.push_back(tasks[j].result);
+			}
 		}
 
 		f->seek(16); //ok write block sizes
@@ -159,6 +249,8 @@ void FileAccessCompressed::_close() {
 	} else {
 		comp_buffer.clear();
 		read_blocks.clear();
+		window_count = 0;
+		read_ptr = nullptr;
 	}
 	buffer.clear();
 	f.unref();
@@ -202,11 +294,8 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			uint32_t block_idx = p_position / block_size;
 			if (block_idx != read_block) {
 				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				const Error err = _load_block(read_block, false);
+				ERR_FAIL_COND_MSG(err != OK, "Compressed file is corrupt.");
 			}
 
 			read_pos = p_position % block_size;
@@ -290,11 +379,9 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 			return dst_idx;
 		}
 
-		// Read the next block of compressed data.
-		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+		// Move to the next block, decompressing the upcoming ones ahead of time if needed.
+		const Error err = _load_block(read_block, true);
+		ERR_FAIL_COND_V_MSG(err != OK, -1, "Compressed file is corrupt.");
 		read_pos = 0;
 	}
 
@@ -51,7 +51,7 @@ class FileAccessCompressed : public FileAccess {
 	};
 
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
@@ -59,10 +59,36 @@ class FileAccessCompressed : public FileAccess {
 	Vector<ReadBlock> read_blocks;
 	uint64_t read_total = 0;
 
+	// Sequential reads decompress several upcoming blocks at once, in parallel.
+	// `buffer` holds the decompressed blocks of this window.
+	uint32_t read_ahead_blocks = 1;
+	mutable uint32_t window_first = 0;
+	mutable uint32_t window_count = 0;
+
 	String magic = "GCMP";
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	// Blocks are compressed independently, so batches of them are processed on the WorkerThreadPool.
+	struct BlockTask {
+		const uint8_t *src = nullptr;
+		uint64_t src_size = 0;
+		uint8_t *dst = nullptr;
+		uint64_t dst_size = 0;
+		int64_t result = -1;
+	};
+
+	struct BlockTaskBatch {
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		bool compress = false;
+		BlockTask *tasks = nullptr;
+	};
+
+	static void _process_block_task(void *p_userdata, uint32_t p_index);
+	static void _run_block_tasks(Compression::Mode p_mode, bool p_compress, BlockTask *p_tasks, uint32_t p_count);
+	uint32_t _get_parallel_block_count() const;
+	Error _load_block(uint32_t p_block, bool p_read_ahead) const;
+
 	void _close();
 
 public:
@@ -181,9 +181,58 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 	}
 }
 
+PackedData::PackMapping PackedData::get_pack_mapping(const String &p_pack_path) {
+	if (!use_pack_mappings) {
+		return PackMapping();
+	}
+
+	MutexLock lock(pack_mappings_mutex);
+
+	HashMap<String, PackMapping>::Iterator E = pack_mappings.find(p_pack_path);
+	if (E) {
+		return E->value;
+	}
+
+	// Unmappable packs are remembered too (with empty data), so they aren't retried on every open.
+	PackMapping mapping;
+	mapping.file = FileAccess::open(p_pack_path, FileAccess::READ);
+	if (mapping.file.is_valid()) {
+		mapping.data = mapping.file->get_mapped_span();
+		if (mapping.data.is_empty()) {
+			mapping.file.unref();
+		}
+	}
+	pack_mappings.insert(p_pack_path, mapping);
+	return mapping;
+}
+
+void PackedData::remove_pack(const String &p_path) {
+	// Files the pack replaced or removed from other packs are not restored.
+	for (const String &path : get_file_paths()) {
+		HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(PathMD5(path.simplify_path().trim_prefix("res://").md5_buffer()));
+		if (E && E->value.pack == p_path) {
+			remove_path(path);
+		}
+	}
+	for (KeyValue<PathMD5, Vector<PackedFile>> &E : delta_patches) {
+		for (int i = E.value.size() - 1; i >= 0; i--) {
+			if (E.value[i].pack == p_path) {
+				E.value.remove_at(i);
+			}
+		}
+	}
+
+	MutexLock lock(pack_mappings_mutex);
+	pack_mappings.erase(p_path); // Open FileAccessPacks keep their mapping alive.
+}
+
 void PackedData::clear() {
 	files.clear();
 	delta_patches.clear();
+	{
+		MutexLock lock(pack_mappings_mutex);
+		pack_mappings.clear(); // Open FileAccessPacks keep their mapping alive.
+	}
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -449,7 +498,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (mapped.is_empty()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -488,6 +539,10 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	if (to_read <= 0) {
 		return 0;
 	}
+	if (!mapped.is_empty()) {
+		memcpy(p_dst, mapped.ptr() + pos - to_read, to_read);
+		return to_read;
+	}
 	f->get_buffer(p_dst, to_read);
 
 	return to_read;
@@ -497,7 +552,9 @@ void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (mapped.is_empty()) {
+		f->set_big_endian(p_big_endian); // The mapped pack file is shared, and not read through.
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -521,6 +578,7 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped = Span<uint8_t>();
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key) {
@@ -544,9 +602,18 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		ERR_FAIL_COND_MSG(f.is_null(), vformat(R"(Can't open pack-referenced file "%s" from sparse pack "%s".)", simplified_path, pf.pack));
 		off = 0; // For the sparse pack offset is always zero.
 	} else {
-		f = FileAccess::open(pf.pack, FileAccess::READ);
-		ERR_FAIL_COND_MSG(f.is_null(), vformat(R"(Can't open pack-referenced file "%s" from pack "%s".)", p_path, pf.pack));
-		f->seek(pf.offset);
+		if (!pf.encrypted && pf.size > 0) {
+			PackedData::PackMapping mapping = PackedData::get_singleton()->get_pack_mapping(pf.pack);
+			if (mapping.data.size() >= pf.offset + pf.size) {
+				f = mapping.file;
+				mapped = Span<uint8_t>(mapping.data.ptr() + pf.offset, pf.size);
+			}
+		}
+		if (mapped.is_empty()) {
+			f = FileAccess::open(pf.pack, FileAccess::READ);
+			ERR_FAIL_COND_MSG(f.is_null(), vformat(R"(Can't open pack-referenced file "%s" from pack "%s".)", p_path, pf.pack));
+			f->seek(pf.offset);
+		}
 		off = pf.offset;
 	}
 
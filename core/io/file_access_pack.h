@@ -32,6 +32,7 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
@@ -78,6 +79,11 @@ public:
 		String salt;
 	};
 
+	struct PackMapping {
+		Ref<FileAccess> file; // Keeps the mapping alive.
+		Span<uint8_t> data;
+	};
+
 private:
 	struct PackedDir {
 		PackedDir *parent = nullptr;
@@ -111,6 +117,11 @@ private:
 
 	Vector<PackSource *> sources;
 
+	// Read-only memory mappings of whole pack files, shared by all FileAccessPacks reading from them.
+	HashMap<String, PackMapping> pack_mappings;
+	Mutex pack_mappings_mutex;
+	bool use_pack_mappings = true;
+
 	PackedDir *root = nullptr;
 
 	static inline PackedData *singleton = nullptr;
@@ -127,12 +138,17 @@ public:
 	Vector<PackedFile> get_delta_patches(const String &p_path) const;
 	bool has_delta_patches(const String &p_path) const;
 	HashSet<String> get_file_paths() const;
+	PackMapping get_pack_mapping(const String &p_pack_path);
+
+	void set_use_pack_mappings(bool p_enabled) { use_pack_mappings = p_enabled; }
+	bool is_using_pack_mappings() const { return use_pack_mappings; }
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
 
 	static PackedData *get_singleton() { return singleton; }
 	Error add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>());
+	void remove_pack(const String &p_path);
 
 	void clear();
 
@@ -179,6 +195,8 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	Span<uint8_t> mapped; // The file contents when the pack is memory-mapped, reads don't go through f then.
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -205,6 +223,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_mapped_span() const override { return mapped; }
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
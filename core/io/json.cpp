@@ -33,6 +33,7 @@
 #include "core/config/engine.h"
 #include "core/io/file_access.h"
 #include "core/object/script_language.h"
+#include "core/string/swar.h"
 #include "core/variant/container_type_validate.h"
 
 const char *JSON::tk_name[TK_MAX] = {
@@ -48,6 +49,38 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
+static String _float_to_string(double p_num, bool p_full_precision) {
+	// JSON does not support NaN or Infinity, so use extremely large numbers for infinity.
+	if (!Math::is_finite(p_num)) {
+		if (p_num == Math::INF) {
+			return "1e99999";
+		} else if (p_num == -Math::INF) {
+			return "-1e99999";
+		} else {
+			WARN_PRINT_ONCE("`NaN` (\"Not a Number\") found in argument passed to JSON.stringify(). `NaN` cannot be represented in JSON, so the value has been replaced with `null`. This warning will not be printed for any later NaN occurrences.");
+			return "null";
+		}
+	}
+	// Only for exactly 0. If we have approximately 0 let the user decide how much
+	// precision they want.
+	if (p_num == double(0.0)) {
+		return "0.0";
+	}
+
+	if (p_full_precision) {
+		const String num_sci = String::num_scientific(p_num);
+		if (num_sci.contains_char('.') || num_sci.contains_char('e')) {
+			return num_sci;
+		} else {
+			return num_sci + ".0";
+		}
+	} else {
+		const double magnitude = std::log10(Math::abs(p_num));
+		const int precision = MAX(1, 14 - (int)Math::floor(magnitude));
+		return String::num(p_num, precision);
+	}
+}
+
 void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
 		r_result += p_indent;
@@ -73,42 +106,9 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 		case Variant::INT:
 			r_result += itos(p_var);
 			return;
-		case Variant::FLOAT: {
-			const double num = p_var;
-
-			// JSON does not support NaN or Infinity, so use extremely large numbers for infinity.
-			if (!Math::is_finite(num)) {
-				if (num == Math::INF) {
-					r_result += "1e99999";
-				} else if (num == -Math::INF) {
-					r_result += "-1e99999";
-				} else {
-					WARN_PRINT_ONCE("`NaN` (\"Not a Number\") found in argument passed to JSON.stringify(). `NaN` cannot be represented in JSON, so the value has been replaced with `null`. This warning will not be printed for any later NaN occurrences.");
-					r_result += "null";
-				}
-				return;
-			}
-			// Only for exactly 0. If we have approximately 0 let the user decide how much
-			// precision they want.
-			if (num == double(0.0)) {
-				r_result += "0.0";
-				return;
-			}
-
-			if (p_full_precision) {
-				const String num_sci = String::num_scientific(num);
-				if (num_sci.contains_char('.') || num_sci.contains_char('e')) {
-					r_result += num_sci;
-				} else {
-					r_result += num_sci + ".0";
-				}
-			} else {
-				const double magnitude = std::log10(Math::abs(num));
-				const int precision = MAX(1, 14 - (int)Math::floor(magnitude));
-				r_result += String::num(num, precision);
-			}
+		case Variant::FLOAT:
+			r_result += _float_to_string(p_var, p_full_precision);
 			return;
-		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
 		case Variant::PACKED_FLOAT32_ARRAY:
@@ -198,6 +198,242 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 	}
 }
 
+// Writes JSON straight into a UTF-8 byte buffer. Produces the same text as
+// _stringify(), without building intermediate Strings for indentation,
+// integers and string contents.
+class JSONUTF8Writer {
+public:
+	LocalVector<uint8_t> buffer;
+	CharString indent;
+	bool sort_keys = true;
+	bool full_precision = false;
+
+	_FORCE_INLINE_ void append(char p_char) {
+		buffer.push_back(p_char);
+	}
+
+	void append(const char *p_str, uint32_t p_len) {
+		const uint32_t size = buffer.size();
+		buffer.resize(size + p_len);
+		memcpy(buffer.ptr() + size, p_str, p_len);
+	}
+
+	void append(const char *p_str) {
+		append(p_str, strlen(p_str));
+	}
+
+	void append_ascii(const String &p_str) {
+		const uint32_t size = buffer.size();
+		const int len = p_str.length();
+		buffer.resize(size + len);
+		const char32_t *src = p_str.ptr();
+		for (int i = 0; i < len; i++) {
+			buffer[size + i] = src[i];
+		}
+	}
+
+	void append_indent(int p_size) {
+		for (int i = 0; i < p_size; i++) {
+			append(indent.get_data(), indent.length());
+		}
+	}
+
+	void append_int(int64_t p_value) {
+		char digits[20];
+		int count = 0;
+		uint64_t value = p_value < 0 ? uint64_t(0) - uint64_t(p_value) : uint64_t(p_value);
+		do {
+			digits[count++] = '0' + value % 10;
+			value /= 10;
+		} while (value);
+
+		if (p_value < 0) {
+			append('-');
+		}
+		while (count) {
+			append(digits[--count]);
+		}
+	}
+
+	// Same escaping as String::json_escape(), encoded as UTF-8.
+	void append_escaped(const String &p_str) {
+		append('"');
+		const char32_t *src = p_str.ptr();
+		const int len = p_str.length();
+		for (int i = 0; i < len; i++) {
+			const char32_t c = src[i];
+			switch (c) {
+				case '\\':
+					append("\\\\", 2);
+					break;
+				case '\b':
+					append("\\b", 2);
+					break;
+				case '\f':
+					append("\\f", 2);
+					break;
+				case '\n':
+					append("\\n", 2);
+					break;
+				case '\r':
+					append("\\r", 2);
+					break;
+				case '\t':
+					append("\\t", 2);
+					break;
+				case '\v':
+					append("\\v", 2);
+					break;
+				case '"':
+					append("\\\"", 2);
+					break;
+				default: {
+					if (c < 0x80) {
+						append(char(c));
+					} else if (c < 0x800) {
+						append(char(0xC0 | (c >> 6)));
+						append(char(0x80 | (c & 0x3F)));
+					} else if (c < 0x10000) {
+						append(char(0xE0 | (c >> 12)));
+						append(char(0x80 | ((c >> 6) & 0x3F)));
+						append(char(0x80 | (c & 0x3F)));
+					} else {
+						append(char(0xF0 | (c >> 18)));
+						append(char(0x80 | ((c >> 12) & 0x3F)));
+						append(char(0x80 | ((c >> 6) & 0x3F)));
+						append(char(0x80 | (c & 0x3F)));
+					}
+				}
+			}
+		}
+		append('"');
+	}
+};
+
+void JSON::_stringify_utf8(JSONUTF8Writer &r_writer, const Variant &p_var, int p_cur_indent, HashSet<const void *> &p_markers) {
+	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
+		r_writer.append("...");
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
+	}
+
+	const bool pretty = r_writer.indent.length() > 0;
+
+	switch (p_var.get_type()) {
+		case Variant::NIL:
+			r_writer.append("null");
+			return;
+		case Variant::BOOL:
+			r_writer.append(p_var.operator bool() ? "true" : "false");
+			return;
+		case Variant::INT:
+			r_writer.append_int(p_var);
+			return;
+		case Variant::FLOAT:
+			r_writer.append_ascii(_float_to_string(p_var, r_writer.full_precision));
+			return;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::ARRAY: {
+			Array a = p_var;
+			if (p_markers.has(a.id())) {
+				r_writer.append("\"[...]\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
+
+			if (a.is_empty()) {
+				r_writer.append("[]", 2);
+				return;
+			}
+
+			r_writer.append('[');
+			if (pretty) {
+				r_writer.append('\n');
+			}
+
+			p_markers.insert(a.id());
+
+			bool first = true;
+			for (const Variant &var : a) {
+				if (first) {
+					first = false;
+				} else {
+					r_writer.append(',');
+					if (pretty) {
+						r_writer.append('\n');
+					}
+				}
+				r_writer.append_indent(p_cur_indent + 1);
+				_stringify_utf8(r_writer, var, p_cur_indent + 1, p_markers);
+			}
+			if (pretty) {
+				r_writer.append('\n');
+			}
+			r_writer.append_indent(p_cur_indent);
+			r_writer.append(']');
+			p_markers.erase(a.id());
+			return;
+		}
+		case Variant::DICTIONARY: {
+			Dictionary d = p_var;
+			if (p_markers.has(d.id())) {
+				r_writer.append("\"{...}\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
+
+			if (d.is_empty()) {
+				r_writer.append("{}", 2);
+				return;
+			}
+
+			r_writer.append('{');
+			if (pretty) {
+				r_writer.append('\n');
+			}
+			p_markers.insert(d.id());
+
+			LocalVector<Variant> keys = d.get_key_list();
+
+			if (r_writer.sort_keys) {
+				keys.sort_custom<StringLikeVariantOrder>();
+			}
+
+			bool first_key = true;
+			for (const Variant &key : keys) {
+				if (first_key) {
+					first_key = false;
+				} else {
+					r_writer.append(',');
+					if (pretty) {
+						r_writer.append('\n');
+					}
+				}
+				r_writer.append_indent(p_cur_indent + 1);
+				r_writer.append_escaped(String(key));
+				if (pretty) {
+					r_writer.append(": ", 2);
+				} else {
+					r_writer.append(':');
+				}
+				_stringify_utf8(r_writer, d[key], p_cur_indent + 1, p_markers);
+			}
+
+			if (pretty) {
+				r_writer.append('\n');
+			}
+			r_writer.append_indent(p_cur_indent);
+			r_writer.append('}');
+			p_markers.erase(d.id());
+			return;
+		}
+		default:
+			r_writer.append_escaped(String(p_var));
+			return;
+	}
+}
+
 Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
@@ -564,6 +800,464 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 	return ERR_PARSE_ERROR;
 }
 
+// Parses JSON straight from UTF-8 bytes. Follows the same grammar and error
+// messages as the char32_t parser above, but doesn't need the input widened to
+// a String first. String contents and indentation are scanned 8 bytes at a
+// time, and strings without escapes are decoded in one go.
+class JSONUTF8Parser {
+	const uint8_t *src = nullptr;
+	int64_t len = 0;
+	int64_t index = 0;
+	LocalVector<char> string_buffer;
+
+	_FORCE_INLINE_ bool _at_end(int64_t p_at) const {
+		return p_at >= len || src[p_at] == 0;
+	}
+
+	void _append_utf8(char32_t p_char) {
+		if (p_char < 0x80) {
+			string_buffer.push_back(char(p_char));
+		} else if (p_char < 0x800) {
+			string_buffer.push_back(char(0xC0 | (p_char >> 6)));
+			string_buffer.push_back(char(0x80 | (p_char & 0x3F)));
+		} else if (p_char < 0x10000) {
+			string_buffer.push_back(char(0xE0 | (p_char >> 12)));
+			string_buffer.push_back(char(0x80 | ((p_char >> 6) & 0x3F)));
+			string_buffer.push_back(char(0x80 | (p_char & 0x3F)));
+		} else {
+			string_buffer.push_back(char(0xF0 | (p_char >> 18)));
+			string_buffer.push_back(char(0x80 | ((p_char >> 12) & 0x3F)));
+			string_buffer.push_back(char(0x80 | ((p_char >> 6) & 0x3F)));
+			string_buffer.push_back(char(0x80 | (p_char & 0x3F)));
+		}
+	}
+
+	void _append_bytes(int64_t p_from, int64_t p_to) {
+		const uint32_t size = string_buffer.size();
+		string_buffer.resize(size + (p_to - p_from));
+		memcpy(string_buffer.ptr() + size, src + p_from, p_to - p_from);
+	}
+
+	Error _parse_hex(int64_t p_at, char32_t &r_value) {
+		r_value = 0;
+		for (int j = 0; j < 4; j++) {
+			if (_at_end(p_at + j)) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			const char32_t c = src[p_at + j];
+			if (!is_hex_digit(c)) {
+				err_str = "Malformed hex constant in string";
+				return ERR_PARSE_ERROR;
+			}
+			r_value <<= 4;
+			if (is_digit(c)) {
+				r_value |= c - '0';
+			} else if (c >= 'a' && c <= 'f') {
+				r_value |= c - 'a' + 10;
+			} else {
+				r_value |= c - 'A' + 10;
+			}
+		}
+		return OK;
+	}
+
+	Error _get_string(JSON::Token &r_token) {
+		int64_t run_start = index;
+		bool has_escapes = false;
+		string_buffer.clear();
+
+		while (true) {
+			// Skip plain string contents 8 bytes at a time.
+			while (index + 8 <= len) {
+				const uint64_t word = SWAR::load(src + index);
+				if (SWAR::has_byte(word, '"') | SWAR::has_byte(word, '\\') | SWAR::has_byte(word, '\n') | SWAR::has_zero(word)) {
+					break;
+				}
+				index += 8;
+			}
+
+			if (_at_end(index)) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+
+			const uint8_t c = src[index];
+			if (c == '"') {
+				if (has_escapes) {
+					_append_bytes(run_start, index);
+					r_token.value = String::utf8(string_buffer.ptr(), string_buffer.size());
+				} else {
+					r_token.value = String::utf8((const char *)src + run_start, index - run_start);
+				}
+				r_token.type = JSON::TK_STRING;
+				index++;
+				return OK;
+			} else if (c == '\\') {
+				_append_bytes(run_start, index);
+				has_escapes = true;
+
+				//escaped characters...
+				index++;
+				if (_at_end(index)) {
+					err_str = "Unterminated string";
+					return ERR_PARSE_ERROR;
+				}
+				char32_t res = 0;
+
+				switch (src[index]) {
+					case 'b':
+						res = 8;
+						break;
+					case 't':
+						res = 9;
+						break;
+					case 'n':
+						res = 10;
+						break;
+					case 'f':
+						res = 12;
+						break;
+					case 'r':
+						res = 13;
+						break;
+					case 'u': {
+						Error err = _parse_hex(index + 1, res);
+						if (err != OK) {
+							return err;
+						}
+						index += 4;
+
+						if ((res & 0xfffffc00) == 0xd800) {
+							if (_at_end(index + 2) || src[index + 1] != '\\' || src[index + 2] != 'u') {
+								err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+								return ERR_PARSE_ERROR;
+							}
+							index += 2;
+							char32_t trail = 0;
+							err = _parse_hex(index + 1, trail);
+							if (err != OK) {
+								return err;
+							}
+							if ((trail & 0xfffffc00) == 0xdc00) {
+								res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+								index += 4;
+							} else {
+								err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+								return ERR_PARSE_ERROR;
+							}
+						} else if ((res & 0xfffffc00) == 0xdc00) {
+							err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+							return ERR_PARSE_ERROR;
+						}
+					} break;
+					case '"':
+					case '\\':
+					case '/': {
+						res = src[index];
+					} break;
+					default: {
+						err_str = "Invalid escape sequence";
+						return ERR_PARSE_ERROR;
+					}
+				}
+
+				_append_utf8(res);
+				index++;
+				run_start = index;
+			} else {
+				if (c == '\n') {
+					line++;
+				}
+				index++;
+			}
+		}
+	}
+
+	Error _get_number(JSON::Token &r_token) {
+		// The input isn't null-terminated, so the number is copied out before converting it.
+		int64_t end = index;
+		while (end < len && (is_digit(src[end]) || src[end] == '-' || src[end] == '+' || src[end] == '.' || src[end] == 'e' || src[end] == 'E')) {
+			end++;
+		}
+
+		char small_number[64];
+		CharString large_number;
+		char *number = small_number;
+		const int64_t number_len = end - index;
+		if (number_len >= (int64_t)sizeof(small_number)) {
+			large_number.resize_uninitialized(number_len + 1);
+			number = large_number.ptrw();
+		}
+		memcpy(number, src + index, number_len);
+		number[number_len] = 0;
+
+		const char *number_end = number;
+		r_token.value = String::to_float(number, &number_end);
+		r_token.type = JSON::TK_NUMBER;
+		index += number_end - number;
+		return OK;
+	}
+
+	Error _get_token(JSON::Token &r_token) {
+		if (len <= 0) {
+			err_str = "Unknown error getting token";
+			return ERR_PARSE_ERROR;
+		}
+
+		while (true) {
+			if (_at_end(index)) {
+				r_token.type = JSON::TK_EOF;
+				return OK;
+			}
+
+			const uint8_t c = src[index];
+			switch (c) {
+				case '\n': {
+					line++;
+					index++;
+					// Skip indentation 8 bytes at a time.
+					while (index + 8 <= len && (SWAR::load(src + index) == SWAR::broadcast(' ') || SWAR::load(src + index) == SWAR::broadcast('\t'))) {
+						index += 8;
+					}
+				} break;
+				case '{': {
+					r_token.type = JSON::TK_CURLY_BRACKET_OPEN;
+					index++;
+					return OK;
+				}
+				case '}': {
+					r_token.type = JSON::TK_CURLY_BRACKET_CLOSE;
+					index++;
+					return OK;
+				}
+				case '[': {
+					r_token.type = JSON::TK_BRACKET_OPEN;
+					index++;
+					return OK;
+				}
+				case ']': {
+					r_token.type = JSON::TK_BRACKET_CLOSE;
+					index++;
+					return OK;
+				}
+				case ':': {
+					r_token.type = JSON::TK_COLON;
+					index++;
+					return OK;
+				}
+				case ',': {
+					r_token.type = JSON::TK_COMMA;
+					index++;
+					return OK;
+				}
+				case '"': {
+					index++;
+					return _get_string(r_token);
+				}
+				default: {
+					if (c <= 32) {
+						index++;
+						break;
+					}
+
+					if (c == '-' || is_digit(c)) {
+						return _get_number(r_token);
+					} else if (is_ascii_alphabet_char(c)) {
+						const int64_t start = index;
+						while (index < len && is_ascii_alphabet_char(src[index])) {
+							index++;
+						}
+
+						r_token.type = JSON::TK_IDENTIFIER;
+						r_token.value = String::ascii(Span<char>((const char *)src + start, index - start));
+						return OK;
+					} else {
+						err_str = "Unexpected character";
+						return ERR_PARSE_ERROR;
+					}
+				}
+			}
+		}
+	}
+
+	Error _parse_value(Variant &r_value, JSON::Token &p_token, int p_depth) {
+		if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+			err_str = "JSON structure is too deep";
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		if (p_token.type == JSON::TK_CURLY_BRACKET_OPEN) {
+			Dictionary d;
+			Error err = _parse_object(d, p_depth + 1);
+			if (err) {
+				return err;
+			}
+			r_value = d;
+		} else if (p_token.type == JSON::TK_BRACKET_OPEN) {
+			Array a;
+			Error err = _parse_array(a, p_depth + 1);
+			if (err) {
+				return err;
+			}
+			r_value = a;
+		} else if (p_token.type == JSON::TK_IDENTIFIER) {
+			String id = p_token.value;
+			if (id == "true") {
+				r_value = true;
+			} else if (id == "false") {
+				r_value = false;
+			} else if (id == "null") {
+				r_value = Variant();
+			} else {
+				err_str = vformat("Expected 'true', 'false', or 'null', got '%s'", id);
+				return ERR_PARSE_ERROR;
+			}
+		} else if (p_token.type == JSON::TK_NUMBER || p_token.type == JSON::TK_STRING) {
+			r_value = p_token.value;
+		} else {
+			err_str = vformat("Expected value, got '%s'", String(JSON::tk_name[p_token.type]));
+			return ERR_PARSE_ERROR;
+		}
+
+		return OK;
+	}
+
+	Error _parse_array(Array &r_array, int p_depth) {
+		JSON::Token token;
+		bool need_comma = false;
+
+		while (index < len) {
+			Error err = _get_token(token);
+			if (err != OK) {
+				return err;
+			}
+
+			if (token.type == JSON::TK_BRACKET_CLOSE) {
+				return OK;
+			}
+
+			if (need_comma) {
+				if (token.type != JSON::TK_COMMA) {
+					err_str = "Expected ','";
+					return ERR_PARSE_ERROR;
+				} else {
+					need_comma = false;
+					continue;
+				}
+			}
+
+			Variant v;
+			err = _parse_value(v, token, p_depth);
+			if (err) {
+				return err;
+			}
+
+			r_array.push_back(v);
+			need_comma = true;
+		}
+
+		err_str = "Expected ']'";
+		return ERR_PARSE_ERROR;
+	}
+
+	Error _parse_object(Dictionary &r_object, int p_depth) {
+		JSON::Token token;
+		bool need_comma = false;
+
+		while (index < len) {
+			Error err = _get_token(token);
+			if (err != OK) {
+				return err;
+			}
+
+			if (token.type == JSON::TK_CURLY_BRACKET_CLOSE) {
+				return OK;
+			}
+
+			if (need_comma) {
+				if (token.type != JSON::TK_COMMA) {
+					err_str = "Expected '}' or ','";
+					return ERR_PARSE_ERROR;
+				} else {
+					need_comma = false;
+					continue;
+				}
+			}
+
+			if (token.type != JSON::TK_STRING) {
+				err_str = "Expected key";
+				return ERR_PARSE_ERROR;
+			}
+
+			const String key = token.value;
+			err = _get_token(token);
+			if (err != OK) {
+				return err;
+			}
+			if (token.type != JSON::TK_COLON) {
+				err_str = "Expected ':'";
+				return ERR_PARSE_ERROR;
+			}
+
+			err = _get_token(token);
+			if (err != OK) {
+				return err;
+			}
+
+			Variant v;
+			err = _parse_value(v, token, p_depth);
+			if (err) {
+				return err;
+			}
+			r_object[key] = v;
+			need_comma = true;
+		}
+
+		err_str = "Expected '}'";
+		return ERR_PARSE_ERROR;
+	}
+
+public:
+	int line = 0;
+	String err_str;
+
+	Error parse(const uint8_t *p_src, int64_t p_len, Variant &r_ret) {
+		src = p_src;
+		len = p_len;
+		index = 0;
+		line = 0;
+
+		// Skip the UTF-8 BOM, like String::utf8() does.
+		if (len >= 3 && src[0] == 0xEF && src[1] == 0xBB && src[2] == 0xBF) {
+			index = 3;
+		}
+
+		JSON::Token token;
+		Error err = _get_token(token);
+		if (err) {
+			return err;
+		}
+
+		err = _parse_value(r_ret, token, 0);
+
+		// Check if EOF is reached
+		// or it's a type of the next token.
+		if (err == OK && index < len) {
+			err = _get_token(token);
+
+			if (err || token.type != JSON::TK_EOF) {
+				err_str = "Expected 'EOF'";
+				// Reset return value to empty `Variant`
+				r_ret = Variant();
+				return ERR_PARSE_ERROR;
+			}
+		}
+
+		return err;
+	}
+};
+
 void JSON::set_data(const Variant &p_data) {
 	data = p_data;
 	text.clear();
@@ -611,6 +1305,17 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8_buffer(const PackedByteArray &p_json_utf8, bool p_keep_text) {
+	JSONUTF8Parser parser;
+	Error err = parser.parse(p_json_utf8.ptr(), p_json_utf8.size(), data);
+	err_str = parser.err_str;
+	err_line = err == Error::OK ? 0 : parser.line;
+	if (p_keep_text) {
+		text = String::utf8((const char *)p_json_utf8.ptr(), p_json_utf8.size());
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
@@ -622,6 +1327,22 @@ String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort
 	return result;
 }
 
+PackedByteArray JSON::stringify_to_utf8_buffer(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	JSONUTF8Writer writer;
+	writer.indent = p_indent.utf8();
+	writer.sort_keys = p_sort_keys;
+	writer.full_precision = p_full_precision;
+	HashSet<const void *> markers;
+	_stringify_utf8(writer, p_var, 0, markers);
+
+	PackedByteArray result;
+	result.resize(writer.buffer.size());
+	if (writer.buffer.size() > 0) {
+		memcpy(result.ptrw(), writer.buffer.ptr(), writer.buffer.size());
+	}
+	return result;
+}
+
 Variant JSON::parse_string(const String &p_json_string) {
 	Ref<JSON> json;
 	json.instantiate();
@@ -634,6 +1355,8 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_static_method("JSON", D_METHOD("stringify_to_utf8_buffer", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify_to_utf8_buffer, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8_buffer", "json_utf8", "keep_text"), &JSON::parse_utf8_buffer, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -1568,7 +2291,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8_buffer(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
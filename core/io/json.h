@@ -35,9 +35,14 @@
 #include "core/io/resource_saver.h"
 #include "core/variant/variant.h"
 
+class JSONUTF8Parser;
+class JSONUTF8Writer;
+
 class JSON : public Resource {
 	GDCLASS(JSON, Resource);
 
+	friend class JSONUTF8Parser;
+
 	enum TokenType {
 		TK_CURLY_BRACKET_OPEN,
 		TK_CURLY_BRACKET_CLOSE,
@@ -73,6 +78,7 @@ class JSON : public Resource {
 
 	static void _add_indent(String &r_result, const String &p_indent, int p_size);
 	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
+	static void _stringify_utf8(JSONUTF8Writer &r_writer, const Variant &p_var, int p_cur_indent, HashSet<const void *> &p_markers);
 	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
 	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
@@ -87,9 +93,11 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8_buffer(const PackedByteArray &p_json_utf8, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	static PackedByteArray stringify_to_utf8_buffer(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
 	_FORCE_INLINE_ static Variant from_native(const Variant &p_variant, bool p_full_objects = false) {
@@ -88,6 +88,49 @@ enum ContainerTypeKind {
 #define GET_CONTAINER_TYPE_KIND(m_header, m_field) \
 	((ContainerTypeKind)(((m_header) & HEADER_DATA_FIELD_##m_field##_MASK) >> HEADER_DATA_FIELD_##m_field##_SHIFT))
 
+// Packed arrays of numbers are stored as little-endian elements, so on
+// little-endian hosts they match the in-memory layout and are copied in bulk.
+template <typename T>
+static void _decode_packed_elements(const uint8_t *p_src, T *r_dst, int32_t p_count) {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+#ifdef BIG_ENDIAN_ENABLED
+	for (int32_t i = 0; i < p_count; i++) {
+		if constexpr (sizeof(T) == 8) {
+			const uint64_t value = decode_uint64(&p_src[i * sizeof(T)]);
+			memcpy(&r_dst[i], &value, sizeof(T));
+		} else {
+			const uint32_t value = decode_uint32(&p_src[i * sizeof(T)]);
+			memcpy(&r_dst[i], &value, sizeof(T));
+		}
+	}
+#else
+	memcpy(r_dst, p_src, p_count * sizeof(T));
+#endif
+}
+
+template <typename T>
+static void _encode_packed_elements(const T *p_src, uint8_t *r_dst, int32_t p_count) {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+	if (p_count == 0) {
+		return;
+	}
+#ifdef BIG_ENDIAN_ENABLED
+	for (int32_t i = 0; i < p_count; i++) {
+		if constexpr (sizeof(T) == 8) {
+			uint64_t value;
+			memcpy(&value, &p_src[i], sizeof(T));
+			encode_uint64(value, &r_dst[i * sizeof(T)]);
+		} else {
+			uint32_t value;
+			memcpy(&value, &p_src[i], sizeof(T));
+			encode_uint32(value, &r_dst[i * sizeof(T)]);
+		}
+	}
+#else
+	memcpy(r_dst, p_src, p_count * sizeof(T));
+#endif
+}
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -928,10 +971,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -955,12 +995,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int32_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
+				_decode_packed_elements(buf, data.ptrw(), count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -979,12 +1015,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int64_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
+				_decode_packed_elements(buf, data.ptrw(), count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -1003,12 +1035,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<float> data;
 
 			if (count) {
-				//const float *rbuf = (const float *)buf;
 				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
+				_decode_packed_elements(buf, data.ptrw(), count);
 			}
 			r_variant = data;
 
@@ -1029,10 +1057,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
+				_decode_packed_elements(buf, data.ptrw(), count);
 			}
 			r_variant = data;
 
@@ -1302,6 +1327,98 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 	return OK;
 }
 
+int PackedArrayView::get_element_size() const {
+	switch (type) {
+		case Variant::PACKED_BYTE_ARRAY:
+			return 1;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return 4;
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return 8;
+		default:
+			return 0;
+	}
+}
+
+Variant PackedArrayView::to_variant() const {
+	switch (type) {
+		case Variant::PACKED_BYTE_ARRAY: {
+			Vector<uint8_t> array;
+			if (count) {
+				array.resize(count);
+				memcpy(array.ptrw(), data, count);
+			}
+			return array;
+		}
+		case Variant::PACKED_INT32_ARRAY: {
+			Vector<int32_t> array;
+			if (count) {
+				array.resize(count);
+				_decode_packed_elements(data, array.ptrw(), count);
+			}
+			return array;
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			Vector<int64_t> array;
+			if (count) {
+				array.resize(count);
+				_decode_packed_elements(data, array.ptrw(), count);
+			}
+			return array;
+		}
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			Vector<float> array;
+			if (count) {
+				array.resize(count);
+				_decode_packed_elements(data, array.ptrw(), count);
+			}
+			return array;
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			Vector<double> array;
+			if (count) {
+				array.resize(count);
+				_decode_packed_elements(data, array.ptrw(), count);
+			}
+			return array;
+		}
+		default: {
+			return Variant();
+		}
+	}
+}
+
+Error decode_packed_array_view(PackedArrayView &r_view, const uint8_t *p_buffer, int p_len, int *r_len) {
+	ERR_FAIL_COND_V(p_len < 8, ERR_INVALID_DATA);
+
+	PackedArrayView view;
+	view.type = Variant::Type(decode_uint32(p_buffer) & HEADER_TYPE_MASK);
+	const int element_size = view.get_element_size();
+	if (element_size == 0) {
+		// Not a fixed-size packed array, use decode_variant() instead.
+		return ERR_UNAVAILABLE;
+	}
+
+	view.count = decode_uint32(p_buffer + 4);
+	ERR_FAIL_MUL_OF(view.count, element_size, ERR_INVALID_DATA);
+	ERR_FAIL_COND_V(view.count < 0 || view.count * element_size > p_len - 8, ERR_INVALID_DATA);
+	view.data = p_buffer + 8;
+
+	if (r_len) {
+		int size = 8 + view.count * element_size;
+		// Byte arrays are padded to 4 bytes.
+		if (size % 4) {
+			size += 4 - size % 4;
+		}
+		*r_len = size;
+	}
+
+	r_view = view;
+	return OK;
+}
+
 static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
 	CharString utf8 = p_string.utf8();
 
@@ -1932,10 +2049,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int32_t *r = data.ptr();
-				for (int32_t i = 0; i < datalen; i++) {
-					encode_uint32(r[i], &buf[i * datasize]);
-				}
+				_encode_packed_elements(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1949,10 +2063,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int64_t *r = data.ptr();
-				for (int64_t i = 0; i < datalen; i++) {
-					encode_uint64(r[i], &buf[i * datasize]);
-				}
+				_encode_packed_elements(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1966,10 +2077,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const float *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_float(r[i], &buf[i * datasize]);
-				}
+				_encode_packed_elements(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1983,10 +2091,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const double *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_double(r[i], &buf[i * datasize]);
-				}
+				_encode_packed_elements(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -2132,6 +2237,23 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+Error encode_variant_to_buffer(const Variant &p_variant, LocalVector<uint8_t> &r_buffer, bool p_full_objects) {
+	int len;
+	Error err = encode_variant(p_variant, nullptr, len, p_full_objects);
+	if (err) {
+		return err;
+	}
+
+	// Append after what the buffer already holds, a buffer that is cleared and reused keeps its capacity.
+	const uint32_t offset = r_buffer.size();
+	r_buffer.resize(offset + len);
+	err = encode_variant(p_variant, r_buffer.ptr() + offset, len, p_full_objects);
+	if (err) {
+		r_buffer.resize(offset);
+	}
+	return err;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't `memcpy()`.
 	// We also don't consider returning a pointer to the passed vectors when `sizeof(real_t) == 4`.
@@ -32,6 +32,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
 #include "core/variant/variant.h"
 
@@ -219,7 +220,20 @@ public:
 	ObjectID get_object_id() const;
 };
 
+// A packed array of bytes or numbers, referenced where it was encoded instead of being copied.
+// `data` points into the decoded buffer, so the view is only valid as long as that buffer is.
+struct PackedArrayView {
+	Variant::Type type = Variant::NIL;
+	const uint8_t *data = nullptr; // Little-endian elements, not necessarily aligned.
+	int32_t count = 0;
+
+	int get_element_size() const;
+	Variant to_variant() const;
+};
+
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
+Error decode_packed_array_view(PackedArrayView &r_view, const uint8_t *p_buffer, int p_len, int *r_len = nullptr);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
+Error encode_variant_to_buffer(const Variant &p_variant, LocalVector<uint8_t> &r_buffer, bool p_full_objects = false);
 
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
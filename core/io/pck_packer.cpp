@@ -34,6 +34,7 @@
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -124,6 +125,8 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->seek(file_base);
 
 	files.clear();
+	first_pending_file = 0;
+	pending_size = 0;
 
 	return OK;
 }
@@ -135,7 +138,6 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 	// Simplify path here and on every 'files' access so that paths that have extra '/'
 	// symbols or 'res://' in them still match the MD5 hash for the saved path.
 	pf.path = p_target_path.simplify_path().trim_prefix("res://");
-	pf.ofs = file->get_position();
 	pf.size = 0;
 	pf.removal = true;
 
@@ -170,23 +172,38 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 	// symbols or 'res://' in them still match the MD5 hash for the saved path.
 	pf.path = p_target_path.simplify_path().trim_prefix("res://");
 	pf.src_path = p_source_path;
-	pf.ofs = file->get_position();
 	pf.size = p_data.size();
+	pf.encrypted = p_encrypt;
+	pf.data = p_data;
 
-	{
-		unsigned char hash[16];
-		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
-		pf.md5.resize(16);
-		for (int i = 0; i < 16; i++) {
-			pf.md5.write[i] = hash[i];
-		}
+	files.push_back(pf);
+
+	pending_size += pf.size;
+	if (pending_size >= pending_batch_size) {
+		return _write_pending_files();
 	}
-	pf.encrypted = p_encrypt;
+	return OK;
+}
 
+void PCKPacker::_hash_pending_file(uint32_t p_index, File *p_files) {
+	File &pf = p_files[p_index];
+	if (pf.removal) {
+		return;
+	}
+
+	unsigned char hash[16];
+	CryptoCore::md5(pf.data.ptr(), pf.data.size(), hash);
+	pf.md5.resize(16);
+	for (int i = 0; i < 16; i++) {
+		pf.md5.write[i] = hash[i];
+	}
+}
+
+Error PCKPacker::_store_file_data(const File &p_file) {
 	Ref<FileAccess> ftmp = file;
 
 	Ref<FileAccessEncrypted> fae;
-	if (p_encrypt) {
+	if (p_file.encrypted) {
 		fae.instantiate();
 		ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
 
@@ -195,7 +212,7 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 		ftmp = fae;
 	}
 
-	ftmp->store_buffer(p_data);
+	ftmp->store_buffer(p_file.data);
 
 	if (fae.is_valid()) {
 		ftmp.unref();
@@ -207,14 +224,52 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 		file->store_8(0);
 	}
 
-	files.push_back(pf);
-
 	return OK;
 }
 
+Error PCKPacker::_write_pending_files() {
+	if (first_pending_file >= files.size()) {
+		return OK;
+	}
+
+	// Hashing the files is independent, so it's spread over the WorkerThreadPool.
+	// Waiting for a group task from inside the pool could deadlock, so pool threads do it serially.
+	File *pending = files.ptrw() + first_pending_file;
+	const uint32_t pending_count = files.size() - first_pending_file;
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (pending_count > 1 && pool && pool->get_thread_index() == -1) {
+		WorkerThreadPool::GroupID group_id = pool->add_template_group_task(this, &PCKPacker::_hash_pending_file, pending, pending_count, -1, true, SNAME("PCKPackerHashFiles"));
+		pool->wait_for_group_task_completion(group_id);
+	} else {
+		for (uint32_t i = 0; i < pending_count; i++) {
+			_hash_pending_file(i, pending);
+		}
+	}
+
+	// Writing happens in order, as offsets depend on the previous files.
+	Error ret = OK;
+	for (int i = first_pending_file; i < files.size(); i++) {
+		File &pf = files.write[i];
+		pf.ofs = file->get_position();
+		if (!pf.removal) {
+			Error err = _store_file_data(pf);
+			if (err != OK) {
+				ret = err;
+			}
+		}
+		pf.data = Vector<uint8_t>();
+	}
+
+	first_pending_file = files.size();
+	pending_size = 0;
+	return ret;
+}
+
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	Error pending_err = _write_pending_files();
+
 	int dir_padding = _get_pad(alignment, file->get_position());
 	for (int i = 0; i < dir_padding; i++) {
 		file->store_8(0);
@@ -277,7 +332,7 @@ Error PCKPacker::flush(bool p_verbose) {
 	}
 
 	file.unref();
-	return OK;
+	return pending_err;
 }
 
 PCKPacker::~PCKPacker() {
@@ -36,6 +36,10 @@ class FileAccess;
 
 class PCKPacker : public RefCounted {
 	GDCLASS(PCKPacker, RefCounted);
+	friend class TestPCKPackerInternalsAccessor;
+
+	// Pending files are written once their total size reaches this, to bound memory usage.
+	static constexpr uint64_t PENDING_BATCH_SIZE = 64 * 1024 * 1024;
 
 	Ref<FileAccess> file;
 	int alignment = 0;
@@ -57,10 +61,19 @@ class PCKPacker : public RefCounted {
 		bool encrypted = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
+
+		// Until written, files are kept pending so that they can be hashed in parallel.
+		Vector<uint8_t> data;
 	};
 	Vector<File> files;
+	int first_pending_file = 0;
+	uint64_t pending_size = 0;
+	uint64_t pending_batch_size = PENDING_BATCH_SIZE;
 
 	Error _add_file(const String &p_target_path, const String &p_source_path, const Vector<uint8_t> &p_data, bool p_encrypt = false);
+	void _hash_pending_file(uint32_t p_index, File *p_files);
+	Error _store_file_data(const File &p_file);
+	Error _write_pending_files();
 
 public:
 	Error pck_start(const String &p_pck_path, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
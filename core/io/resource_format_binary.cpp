@@ -35,6 +35,7 @@
 #include "core/io/file_access_compressed.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 #include "core/version.h"
 #include "scene/property_utils.h"
 #include "scene/resources/packed_scene.h"
@@ -95,9 +96,14 @@ enum {
 	// Version 4: New string ID for ext/subresources, breaks forward compat.
 	// Version 5: Ability to store script class in the header.
 	// Version 6: Added PackedVector4Array Variant type.
-	FORMAT_VERSION = 6,
+	// Version 7: Property index for each internal resource, packed array data aligned to 16 bytes.
+	FORMAT_VERSION = 7,
 	FORMAT_VERSION_CAN_RENAME_DEPS = 1,
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
+	FORMAT_VERSION_PROPERTY_INDEX = 7,
+	// Name index (32 bits) and offset from the start of the resource (64 bits).
+	PROPERTY_INDEX_ENTRY_SIZE = 12,
+	PACKED_ARRAY_ALIGNMENT = 16,
 };
 
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
@@ -109,6 +115,18 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+void ResourceLoaderBinary::_advance_packed_array_alignment() {
+	if (ver_format < FORMAT_VERSION_PROPERTY_INDEX) {
+		return;
+	}
+
+	uint64_t pos = f->get_position();
+	uint64_t extra = (PACKED_ARRAY_ALIGNMENT - pos % PACKED_ARRAY_ALIGNMENT) % PACKED_ARRAY_ALIGNMENT;
+	if (extra) {
+		f->seek(pos + extra);
+	}
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
@@ -157,14 +175,10 @@ StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
-		return String::utf8(&str_buf[0], len);
+		return _read_utf8(len);
 	}
 
 	return string_map[id];
@@ -508,6 +522,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_BYTE_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<uint8_t> array;
 			array.resize(len);
@@ -520,6 +535,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_INT32_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<int32_t> array;
 			array.resize(len);
@@ -539,6 +555,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_INT64_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<int64_t> array;
 			array.resize(len);
@@ -558,6 +575,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_FLOAT32_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<float> array;
 			array.resize(len);
@@ -577,6 +595,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_FLOAT64_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<double> array;
 			array.resize(len);
@@ -608,6 +627,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_VECTOR2_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<Vector2> array;
 			array.resize(len);
@@ -621,6 +641,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_VECTOR3_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<Vector3> array;
 			array.resize(len);
@@ -634,6 +655,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_COLOR_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<Color> array;
 			array.resize(len);
@@ -655,6 +677,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_VECTOR4_ARRAY: {
 			uint32_t len = f->get_32();
+			_advance_packed_array_alignment();
 
 			Vector<Vector4> array;
 			array.resize(len);
@@ -810,6 +833,10 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		int pc = f->get_32();
+		if (ver_format >= FORMAT_VERSION_PROPERTY_INDEX) {
+			// Properties are read in order, the index is only needed to read them individually.
+			f->seek(f->get_position() + uint64_t(pc) * PROPERTY_INDEX_ENTRY_SIZE);
+		}
 
 		//set properties
 
@@ -903,6 +930,62 @@ Error ResourceLoaderBinary::load() {
 	return ERR_FILE_EOF;
 }
 
+Error ResourceLoaderBinary::load_property(const String &p_id, const StringName &p_property, Variant &r_value) {
+	if (error != OK) {
+		return error;
+	}
+	ERR_FAIL_COND_V(f.is_null() || internal_resources.is_empty(), ERR_UNCONFIGURED);
+
+	int index = -1;
+	if (p_id.is_empty()) {
+		index = internal_resources.size() - 1; // Main resource.
+	} else {
+		const String local_id = "local://" + p_id;
+		const String path_id = res_path + "::" + p_id;
+		for (int i = 0; i < internal_resources.size() - 1; i++) {
+			if (internal_resources[i].path == local_id || internal_resources[i].path == path_id) {
+				index = i;
+				break;
+			}
+		}
+	}
+	ERR_FAIL_COND_V_MSG(index < 0, ERR_DOES_NOT_EXIST, vformat("'%s': No sub-resource with ID '%s'.", local_path, p_id));
+
+	const uint64_t resource_ofs = internal_resources[index].offset;
+	f->seek(resource_ofs);
+	get_unicode_string(); // Type.
+	uint32_t pc = f->get_32();
+
+	if (ver_format >= FORMAT_VERSION_PROPERTY_INDEX) {
+		for (uint32_t i = 0; i < pc; i++) {
+			StringName name = _get_string();
+			uint64_t property_ofs = f->get_64();
+			if (name == p_property) {
+				f->seek(resource_ofs + property_ofs);
+				_get_string(); // Name, as in the index.
+				return parse_variant(r_value);
+			}
+		}
+		return ERR_DOES_NOT_EXIST;
+	}
+
+	// No index in older files, the properties before the requested one must be parsed.
+	for (uint32_t i = 0; i < pc; i++) {
+		StringName name = _get_string();
+		Variant value;
+		Error err = parse_variant(value);
+		if (err != OK) {
+			return err;
+		}
+		if (name == p_property) {
+			r_value = value;
+			return OK;
+		}
+	}
+
+	return ERR_DOES_NOT_EXIST;
+}
+
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
 	translation_remapped = p_remapped;
 }
@@ -921,16 +1004,26 @@ static String get_ustring(Ref<FileAccess> f) {
 	return String::utf8(&str_buf[0], len);
 }
 
+String ResourceLoaderBinary::_read_utf8(uint32_t p_len) {
+	uint64_t pos = f->get_position();
+	if (!f_mapped.is_empty() && pos + p_len <= f_mapped.size()) {
+		f->seek(pos + p_len);
+		return String::utf8((const char *)f_mapped.ptr() + pos, p_len);
+	}
+
+	if ((int)p_len > str_buf.size()) {
+		str_buf.resize(p_len);
+	}
+	f->get_buffer((uint8_t *)&str_buf[0], p_len);
+	return String::utf8(&str_buf[0], p_len);
+}
+
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
-	if (len == 0) {
+	if (len <= 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
-	return String::utf8(&str_buf[0], len);
+	return _read_utf8(len);
 }
 
 void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes) {
@@ -1002,6 +1095,7 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 		f.unref();
 		ERR_FAIL_MSG(vformat("Unrecognized binary resource file: '%s'.", local_path));
 	}
+	f_mapped = f->get_mapped_span();
 
 	bool big_endian = f->get_32();
 	bool use_real64 = f->get_32();
@@ -1121,6 +1215,7 @@ String ResourceLoaderBinary::recognize(Ref<FileAccess> p_f) {
 	error = OK;
 
 	f = p_f;
+	f_mapped = Span<uint8_t>();
 	uint8_t header[4];
 	f->get_buffer(header, 4);
 	if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
@@ -1162,6 +1257,7 @@ String ResourceLoaderBinary::recognize_script_class(Ref<FileAccess> p_f) {
 	error = OK;
 
 	f = p_f;
+	f_mapped = Span<uint8_t>();
 	uint8_t header[4];
 	f->get_buffer(header, 4);
 	if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
@@ -1255,6 +1351,18 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	return loader.resource;
 }
 
+Error ResourceFormatLoaderBinary::load_resource_property(const String &p_path, const String &p_id, const StringName &p_property, Variant &r_value) const {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open file '%s'.", p_path));
+
+	ResourceLoaderBinary loader;
+	loader.local_path = ProjectSettings::get_singleton()->localize_path(p_path);
+	loader.res_path = loader.local_path;
+	loader.open(f);
+	return loader.load_property(p_id, p_property, r_value);
+}
+
 void ResourceFormatLoaderBinary::get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const {
 	if (p_type.is_empty()) {
 		get_recognized_extensions(p_extensions);
@@ -1473,6 +1581,14 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 
 	int64_t size_diff = (int64_t)fw->get_position() - (int64_t)f->get_position();
 
+	// Packed array data must stay aligned, so the rest of the file can only move by multiples of the alignment.
+	// Internal resources are only reached through their offsets, so the padding goes right before them.
+	int64_t alignment_padding = 0;
+	if (ver_format >= FORMAT_VERSION_PROPERTY_INDEX) {
+		alignment_padding = (PACKED_ARRAY_ALIGNMENT - (size_diff % PACKED_ARRAY_ALIGNMENT + PACKED_ARRAY_ALIGNMENT) % PACKED_ARRAY_ALIGNMENT) % PACKED_ARRAY_ALIGNMENT;
+		size_diff += alignment_padding;
+	}
+
 	//internal resources
 	uint32_t int_resources_size = f->get_32();
 	fw->store_32(int_resources_size);
@@ -1484,6 +1600,10 @@ Error ResourceFormatLoaderBinary::rename_dependencies(const String &p_path, cons
 		fw->store_64(offset + size_diff);
 	}
 
+	for (int64_t i = 0; i < alignment_padding; i++) {
+		fw->store_8(0);
+	}
+
 	//rest of file
 	uint8_t b = f->get_8();
 	while (!f->eof_reached()) {
@@ -1621,6 +1741,14 @@ void ResourceFormatSaverBinaryInstance::_pad_buffer(Ref<FileAccess> f, int p_byt
 	}
 }
 
+void ResourceFormatSaverBinaryInstance::_pad_packed_array_alignment(Ref<FileAccess> f) {
+	// Lets the array data be used straight from a mapped file.
+	uint64_t extra = (PACKED_ARRAY_ALIGNMENT - f->get_position() % PACKED_ARRAY_ALIGNMENT) % PACKED_ARRAY_ALIGNMENT;
+	for (uint64_t i = 0; i < extra; i++) {
+		f->store_8(0);
+	}
+}
+
 void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint) {
 	switch (p_property.get_type()) {
 		case Variant::NIL: {
@@ -1925,6 +2053,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<uint8_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const uint8_t *r = arr.ptr();
 			f->store_buffer(r, len);
 			_pad_buffer(f, len);
@@ -1935,6 +2064,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int32_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const int32_t *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_32(uint32_t(r[i]));
@@ -1946,6 +2076,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int64_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const int64_t *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_64(uint64_t(r[i]));
@@ -1957,6 +2088,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<float> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const float *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_float(r[i]);
@@ -1968,6 +2100,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<double> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const double *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_double(r[i]);
@@ -1990,6 +2123,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector2> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const Vector2 *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_real(r[i].x);
@@ -2002,6 +2136,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector3> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const Vector3 *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_real(r[i].x);
@@ -2015,6 +2150,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Color> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const Color *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_float(r[i].r);
@@ -2029,6 +2165,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector4> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_packed_array_alignment(f);
 			const Vector4 *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_real(r[i].x);
@@ -2382,14 +2519,33 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 
 	//now actually save the resources
 	for (const ResourceData &rd : resources) {
-		ofs_table.push_back(f->get_position());
+		uint64_t resource_ofs = f->get_position();
+		ofs_table.push_back(resource_ofs);
 		save_unicode_string(f, rd.type);
 		f->store_32(uint32_t(rd.properties.size()));
 
+		// Property index, filled once the offsets are known.
+		uint64_t index_ofs = f->get_position();
+		for (int i = 0; i < rd.properties.size(); i++) {
+			f->store_32(0);
+			f->store_64(0);
+		}
+
+		LocalVector<uint64_t> property_ofs;
 		for (const Property &p : rd.properties) {
+			property_ofs.push_back(f->get_position() - resource_ofs);
 			f->store_32(uint32_t(p.name_idx));
 			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
 		}
+
+		uint64_t end_ofs = f->get_position();
+		f->seek(index_ofs);
+		int idx = 0;
+		for (const Property &p : rd.properties) {
+			f->store_32(uint32_t(p.name_idx));
+			f->store_64(property_ofs[idx++]);
+		}
+		f->seek(end_ofs);
 	}
 
 	for (int i = 0; i < ofs_table.size(); i++) {
@@ -44,6 +44,7 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	Span<uint8_t> f_mapped; // Contents of f when it's readable straight from memory, strings are decoded in place then.
 
 	uint64_t importmd_ofs = 0;
 
@@ -55,6 +56,7 @@ class ResourceLoaderBinary {
 	Vector<StringName> string_map;
 
 	StringName _get_string();
+	String _read_utf8(uint32_t p_len);
 
 	struct ExtResource {
 		String path;
@@ -80,6 +82,7 @@ class ResourceLoaderBinary {
 
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
+	void _advance_packed_array_alignment();
 
 	HashMap<String, String> remaps;
 	Error error = OK;
@@ -104,6 +107,10 @@ public:
 	String recognize_script_class(Ref<FileAccess> p_f);
 	void get_dependencies(Ref<FileAccess> p_f, List<String> *p_dependencies, bool p_add_types);
 	void get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes);
+
+	// Reads a single property of an internal resource (the main one if p_id is empty) after open(), without loading the resource.
+	// References to other resources in the value are not resolved.
+	Error load_property(const String &p_id, const StringName &p_property, Variant &r_value);
 };
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
@@ -111,6 +118,7 @@ class ResourceFormatLoaderBinary : public ResourceFormatLoader {
 
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
+	Error load_resource_property(const String &p_path, const String &p_id, const StringName &p_property, Variant &r_value) const;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
 	virtual bool handles_type(const String &p_type) const override;
@@ -160,6 +168,7 @@ class ResourceFormatSaverBinaryInstance {
 	};
 
 	static void _pad_buffer(Ref<FileAccess> f, int p_bytes);
+	static void _pad_packed_array_alignment(Ref<FileAccess> f);
 	void _find_resources(const Variant &p_variant, bool p_main = false);
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
 	int get_string_index(const String &p_string);
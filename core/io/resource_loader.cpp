@@ -576,6 +576,18 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 
+		if (p_thread_mode == LOAD_THREAD_DISTRIBUTE && !p_for_user && load_paths_stack.size()) {
+			// A dependency handed to the pool is loaded from another thread, where _load() can't see
+			// the resource that requested it. Track it here, so progress covers the whole dependency graph.
+			const String &parent_task_path = load_paths_stack.get(load_paths_stack.size() - 1);
+			if (parent_task_path != local_path) {
+				HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(parent_task_path);
+				if (E) {
+					E->value.sub_tasks.insert(local_path);
+				}
+			}
+		}
+
 		if (p_for_user) {
 			LoadToken *existing_token = _load_threaded_request_reuse_user_token(p_path);
 			if (existing_token) {
@@ -664,22 +676,24 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	return load_token;
 }
 
-float ResourceLoader::_dependency_get_progress(const String &p_path) {
+float ResourceLoader::_dependency_get_progress(const String &p_path, uint64_t p_progress_check) {
 	if (thread_load_tasks.has(p_path)) {
 		ThreadLoadTask &load_task = thread_load_tasks[p_path];
-		if (load_task.in_progress_check) {
-			// Given the fact that any resource loaded when an outer stack frame is
-			// loading another one is considered a dependency of it, for progress
-			// tracking purposes, a cycle can happen if even if the original resource
-			// graphs involved have none. For instance, preload() can cause this.
+		if (load_task.last_progress_check == p_progress_check) {
+			// Either already measured in this check, as dependencies shared by several
+			// resources are reached once per path to them, or a cycle. Given the fact that
+			// any resource loaded when an outer stack frame is loading another one is
+			// considered a dependency of it, for progress tracking purposes, a cycle can
+			// happen if even if the original resource graphs involved have none.
+			// For instance, preload() can cause this.
 			return load_task.max_reported_progress;
 		}
-		load_task.in_progress_check = true;
+		load_task.last_progress_check = p_progress_check;
 		float current_progress = 0.0;
 		int dep_count = load_task.sub_tasks.size();
 		if (dep_count > 0) {
 			for (const String &E : load_task.sub_tasks) {
-				current_progress += _dependency_get_progress(E);
+				current_progress += _dependency_get_progress(E, p_progress_check);
 			}
 			current_progress /= float(dep_count);
 			current_progress *= 0.5;
@@ -688,7 +702,6 @@ float ResourceLoader::_dependency_get_progress(const String &p_path) {
 			current_progress = load_task.progress;
 		}
 		load_task.max_reported_progress = MAX(load_task.max_reported_progress, current_progress);
-		load_task.in_progress_check = false;
 		return load_task.max_reported_progress;
 	} else {
 		return 1.0; //assume finished loading it so it no longer exists
@@ -719,7 +732,7 @@ ResourceLoader::ThreadLoadStatus ResourceLoader::load_threaded_get_status(const
 
 		status = load_task_ptr->status;
 		if (r_progress) {
-			*r_progress = _dependency_get_progress(local_path);
+			*r_progress = _dependency_get_progress(local_path, ++progress_check_count);
 		}
 
 		// Support userland polling in a loop on the main thread.
@@ -1598,6 +1611,7 @@ thread_local SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG>::TLSData SafeBina
 SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG> ResourceLoader::thread_load_mutex;
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
 bool ResourceLoader::cleaning_tasks = false;
+uint64_t ResourceLoader::progress_check_count = 0;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
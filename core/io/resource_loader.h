@@ -105,6 +105,7 @@ typedef void (*ResourceLoadedCallback)(Ref<Resource> p_resource, const String &p
 class ResourceLoader {
 	friend class LoadToken;
 	friend class CoreBind::ResourceLoader;
+	friend class TestResourceLoaderInternalsAccessor;
 
 	enum {
 		MAX_LOADERS = 64
@@ -184,6 +185,7 @@ private:
 		float progress = 0.0f;
 		float max_reported_progress = 0.0f;
 		uint64_t last_progress_check_main_thread_frame = UINT64_MAX;
+		uint64_t last_progress_check = 0; // Measure shared dependencies once per progress check, and guard against recursion cycles. Cycles are not expected, but can happen due to how it's currently implemented.
 		ThreadLoadStatus status = THREAD_LOAD_IN_PROGRESS;
 		ResourceFormatLoader::CacheMode cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE;
 		Error error = OK;
@@ -192,7 +194,6 @@ private:
 
 		bool awaited : 1; // If it's in the pool, this helps not awaiting from more than one dependent thread.
 		bool need_wait : 1;
-		bool in_progress_check : 1; // Measure against recursion cycles in progress reporting. Cycles are not expected, but can happen due to how it's currently implemented.
 		bool use_sub_threads : 1;
 
 		struct ResourceChangedConnection {
@@ -205,7 +206,6 @@ private:
 		ThreadLoadTask() :
 				awaited(false),
 				need_wait(true),
-				in_progress_check(false),
 				use_sub_threads(false) {}
 	};
 	static void _run_load_task(void *p_userdata);
@@ -221,10 +221,11 @@ private:
 
 	static HashMap<String, ThreadLoadTask> thread_load_tasks;
 	static bool cleaning_tasks;
+	static uint64_t progress_check_count;
 
 	static HashMap<String, LoadToken *> user_load_tokens;
 
-	static float _dependency_get_progress(const String &p_path);
+	static float _dependency_get_progress(const String &p_path, uint64_t p_progress_check);
 
 	static bool _ensure_load_progress();
 
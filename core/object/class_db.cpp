@@ -1811,6 +1811,24 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_setter_method(const StringName &p_class, const StringName &p_property, int *r_index) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (r_index) {
+				*r_index = psg->index;
+			}
+			return psg->_setptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
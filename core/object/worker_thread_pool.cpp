@@ -188,7 +188,14 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 	while (true) {
 		Task *task_to_process = nullptr;
-		{
+
+		// Fast path: tasks this thread posted itself, then tasks posted by other pool threads.
+		// Neither needs the shared lock.
+		if (!thread_data->work_queue.pop(task_to_process)) {
+			task_to_process = thread_data->pool->_steal_task(thread_data);
+		}
+
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -201,17 +208,22 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					break;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				// Local queues are only pushed to with the lock held, so checking them here can't miss a notification.
+				task_to_process = thread_data->pool->_steal_task(thread_data);
+				if (task_to_process) {
+					break;
+				}
+
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
 			}
 		}
 
@@ -245,10 +257,18 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// High-priority tasks posted from a pool thread go to its local queue, where it can pick them
+	// up again without locking and idle threads can steal them. Pump tasks need the shared queue
+	// so the logic keeping them away from some threads applies.
+	bool use_local_queue = work_stealing && p_high_priority && caller_pool_thread && !p_pump_task;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			if (!use_local_queue || !caller_pool_thread->work_queue.push(p_tasks[i])) {
+				// Not eligible or local queue full.
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -327,6 +347,39 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_steal_task(const ThreadData *p_thief) {
+	if (!work_stealing) {
+		return nullptr;
+	}
+
+	// Start at the next thread so thieves spread over victims.
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		ThreadData &victim = threads[(p_thief->index + i) % thread_count];
+		Task *task = nullptr;
+		// A failed steal with items left means another thread won the race; try again.
+		while (!victim.work_queue.is_empty()) {
+			if (victim.work_queue.steal(task)) {
+				return task;
+			}
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_stealable_tasks() const {
+	if (!work_stealing) {
+		return false;
+	}
+
+	for (const ThreadData &th : threads) {
+		if (!th.work_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
@@ -517,7 +570,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_stealable_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -535,7 +588,9 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			if (p_caller_pool_thread->work_queue.pop(task_to_process)) {
+				// Most recently posted local task first. These are never pump tasks.
+			} else if (p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				if ((p_task == ThreadData::YIELDING || p_caller_pool_thread->has_pump_task == true) && task_to_process->is_pump_task) {
 					task_to_process = nullptr;
@@ -543,6 +598,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				} else {
 					task_queue.remove(task_queue.first());
 				}
+			} else {
+				task_to_process = _steal_task(p_caller_pool_thread);
 			}
 
 			if (!task_to_process) {
@@ -588,7 +645,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_stealable_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -807,10 +864,11 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, bool p_work_stealing) {
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
+	work_stealing = p_work_stealing;
 
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
@@ -818,7 +876,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	max_low_priority_threads = CLAMP(p_thread_count * p_low_priority_task_ratio, 1, p_thread_count - 1);
 
-	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority.", p_thread_count, max_low_priority_threads));
+	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority, work stealing %s.", p_thread_count, max_low_priority_threads, work_stealing ? "enabled" : "disabled"));
 
 #ifdef THREADS_ENABLED
 	// Reserve 5 threads in case we need separate threads for 1) 2D physics 2) 3D physics 3) rendering 4) GPU texture compression, 5) all other tasks.
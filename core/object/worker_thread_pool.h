@@ -40,6 +40,7 @@
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -123,6 +124,8 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		// High-priority tasks posted by this thread. Only this thread pushes or pops, others steal.
+		WorkStealingDeque<Task *> work_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -172,6 +175,8 @@ private:
 	uint64_t last_task = 1;
 	int pump_task_count = 0;
 
+	bool work_stealing = true;
+
 	static HashMap<StringName, WorkerThreadPool *> named_pools;
 
 	static void _thread_function(void *p_user);
@@ -183,6 +188,9 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	Task *_steal_task(const ThreadData *p_thief);
+	bool _has_stealable_tasks() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -295,7 +303,7 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, bool p_work_stealing = true);
 	void exit_languages_threads();
 	void finish();
 	WorkerThreadPool(bool p_singleton = true);
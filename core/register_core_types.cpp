@@ -352,6 +352,7 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+	GLOBAL_DEF("threading/worker_pool/work_stealing", true);
 }
 
 void register_early_core_singletons() {
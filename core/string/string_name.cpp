@@ -40,30 +40,166 @@ struct StringName::Table {
 	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
 	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
 
-	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	// Buckets are spread over shards by their low bits. Each shard has its own lock and allocator,
+	// so threads interning unrelated names rarely wait on each other.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+	constexpr static uint32_t SHARD_MASK = SHARD_COUNT - 1;
+
+	// Chains are short. The bound only matters if the lock-free lookup wanders through nodes
+	// being recycled concurrently, which could otherwise link back into an earlier chain.
+	constexpr static uint32_t MAX_LOCK_FREE_STEPS = 32;
+
+	struct Shard {
+		BinaryMutex mutex;
+		PagedAllocator<_Data, false, 256> allocator;
+	};
+
+	static inline std::atomic<_Data *> table[TABLE_LEN];
+	static inline Shard shards[SHARD_COUNT];
+
+	_FORCE_INLINE_ static Shard &get_shard(uint32_t p_idx) { return shards[p_idx & SHARD_MASK]; }
+
+	static void lock_all() {
+		for (Shard &shard : shards) {
+			shard.mutex.lock();
+		}
+	}
+
+	static void unlock_all() {
+		for (Shard &shard : shards) {
+			shard.mutex.unlock();
+		}
+	}
+
+	template <typename T>
+	static _Data *find_lock_free(const T &p_name, uint32_t p_hash);
+	template <typename T>
+	static _Data *intern(const T &p_name, uint32_t p_hash, bool p_static);
 };
 
+// Finds and references an existing name without taking any lock.
+// A node freed concurrently goes back to its allocator page. Pages are only released by
+// cleanup(), so the slot stays mapped and walking through it is safe, but it may be
+// recycled for another name at any time. Only the atomic members (refcount and next)
+// are read before holding a reference. The reference can't be taken while the node is
+// freed or being set up, as its count is 0 until intern() publishes the new name and
+// hash with a release store. Once referenced, hash and name are stable and can be
+// compared. A miss isn't authoritative, the caller must check again under the shard lock.
+template <typename T>
+StringName::_Data *StringName::Table::find_lock_free(const T &p_name, uint32_t p_hash) {
+	_Data *d = table[p_hash & TABLE_MASK].load(std::memory_order_acquire);
+
+	for (uint32_t steps = 0; d && steps < MAX_LOCK_FREE_STEPS; steps++) {
+		if (!d->refcount.ref()) {
+			d = d->next.load(std::memory_order_acquire);
+			continue;
+		}
+
+		if (d->hash == p_hash && d->name == p_name) {
+			return d;
+		}
+
+		// Referenced a node for another name; drop it, which may free it.
+		_Data *next = d->next.load(std::memory_order_acquire);
+		StringName dropped(d);
+		d = next;
+	}
+
+	return nullptr;
+}
+
+template <typename T>
+StringName::_Data *StringName::Table::intern(const T &p_name, uint32_t p_hash, bool p_static) {
+	_Data *d = nullptr;
+
+#ifdef DEBUG_ENABLED
+	// Reference counting for debugging isn't atomic, so it must happen under the lock.
+	if (likely(!debug_stringname))
+#endif
+	{
+		d = find_lock_free(p_name, p_hash);
+		if (d) {
+			if (p_static) {
+				d->static_count.increment();
+			}
+			return d;
+		}
+	}
+
+	const uint32_t idx = p_hash & TABLE_MASK;
+	Shard &shard = get_shard(idx);
+
+	MutexLock lock(shard.mutex);
+	d = table[idx].load(std::memory_order_relaxed);
+
+	while (d) {
+		// compare hash first
+		if (d->hash == p_hash && d->name == p_name) {
+			break;
+		}
+		d = d->next.load(std::memory_order_relaxed);
+	}
+
+	if (d && d->refcount.ref()) {
+		// exists
+		if (p_static) {
+			d->static_count.increment();
+		}
+#ifdef DEBUG_ENABLED
+		if (unlikely(debug_stringname)) {
+			d->debug_references++;
+		}
+#endif
+		return d;
+	}
+
+	d = shard.allocator.alloc();
+	d->name = p_name;
+	d->hash = p_hash;
+	d->static_count.set(p_static ? 1 : 0);
+	d->prev = nullptr;
+	// Last, as this lets lock-free lookups reference the node and read the fields above.
+	d->refcount.init();
+
+#ifdef DEBUG_ENABLED
+	if (unlikely(debug_stringname)) {
+		// Keep in memory, force static.
+		d->refcount.ref();
+		d->static_count.increment();
+	}
+#endif
+
+	_Data *head = table[idx].load(std::memory_order_relaxed);
+	d->next.store(head, std::memory_order_relaxed);
+	if (head) {
+		head->prev = d;
+	}
+	// Publish only once fully set up, lock-free lookups may see it right away.
+	table[idx].store(d, std::memory_order_release);
+
+	return d;
+}
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
 	for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
-		Table::table[i] = nullptr;
+		Table::table[i].store(nullptr, std::memory_order_relaxed);
 	}
 	configured = true;
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
+	Table::lock_all();
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
 		for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
-			_Data *d = Table::table[i];
+			_Data *d = Table::table[i].load(std::memory_order_relaxed);
 			while (d) {
 				data.push_back(d);
-				d = d->next;
+				d = d->next.load(std::memory_order_relaxed);
 			}
 		}
 
@@ -87,8 +223,8 @@ void StringName::cleanup() {
 #endif
 	int lost_strings = 0;
 	for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
-		while (Table::table[i]) {
-			_Data *d = Table::table[i];
+		_Data *d = Table::table[i].load(std::memory_order_relaxed);
+		while (d) {
 			if (d->static_count.get() != d->refcount.get()) {
 				lost_strings++;
 
@@ -97,36 +233,44 @@ void StringName::cleanup() {
 				}
 			}
 
-			Table::table[i] = Table::table[i]->next;
-			Table::allocator.free(d);
+			_Data *next = d->next.load(std::memory_order_relaxed);
+			Table::get_shard(i).allocator.free(d);
+			d = next;
 		}
+		Table::table[i].store(nullptr, std::memory_order_relaxed);
 	}
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
 	configured = false;
+
+	Table::unlock_all();
 }
 
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
+		const uint32_t idx = _data->hash & Table::TABLE_MASK;
+		Table::Shard &shard = Table::get_shard(idx);
+		MutexLock lock(shard.mutex);
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
 		}
+
+		// The node keeps its own `next`, so lock-free lookups standing on it can move on.
+		_Data *next = _data->next.load(std::memory_order_relaxed);
 		if (_data->prev) {
-			_data->prev->next = _data->next;
+			_data->prev->next.store(next, std::memory_order_release);
 		} else {
-			const uint32_t idx = _data->hash & Table::TABLE_MASK;
-			Table::table[idx] = _data->next;
+			Table::table[idx].store(next, std::memory_order_release);
 		}
 
-		if (_data->next) {
-			_data->next->prev = _data->prev;
+		if (next) {
+			next->prev = _data->prev;
 		}
-		Table::allocator.free(_data);
+		shard.allocator.free(_data);
 	}
 
 	_data = nullptr;
@@ -211,52 +355,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & Table::TABLE_MASK;
-
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->name == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = Table::allocator.alloc();
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
-
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	_data = Table::intern(p_name, String::hash(p_name), p_static);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -268,51 +367,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	const uint32_t hash = p_name.hash();
-	const uint32_t idx = hash & Table::TABLE_MASK;
-
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
-
-	while (_data) {
-		if (_data->hash == hash && _data->name == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = Table::allocator.alloc();
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	_data = Table::intern(p_name, p_name.hash(), p_static);
 }
 
 bool operator==(const String &p_name, const StringName &p_string_name) {
@@ -50,7 +50,14 @@ class [[nodiscard]] StringName {
 
 		uint32_t hash = 0;
 		_Data *prev = nullptr;
-		_Data *next = nullptr;
+		// Atomic because lookups of existing names walk the chains without locking.
+		// Stored in the constructor instead of initialized, so that recycling a node
+		// doesn't race with lookups still reading it.
+		std::atomic<_Data *> next;
+
+		_Data() {
+			next.store(nullptr, std::memory_order_relaxed);
+		}
 	};
 
 	_Data *_data = nullptr;
@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*  swar.h                                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/typedefs.h"
+
+#include <cstring>
+
+// Byte scanning 8 bytes at a time in a 64-bit word (SIMD within a register).
+// It's portable, so the text parsers in core don't need platform-specific intrinsics.
+namespace SWAR {
+
+static constexpr uint64_t ONES = 0x0101010101010101ULL;
+static constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+
+// Loads 8 bytes from a possibly unaligned address.
+static _FORCE_INLINE_ uint64_t load(const uint8_t *p_src) {
+	uint64_t word;
+	memcpy(&word, p_src, sizeof(uint64_t));
+	return word;
+}
+
+// Returns a word with every byte set to the given byte.
+static constexpr uint64_t broadcast(uint8_t p_byte) {
+	return ONES * p_byte;
+}
+
+// Non-zero if any byte of the word is zero.
+static constexpr uint64_t has_zero(uint64_t p_word) {
+	return (p_word - ONES) & ~p_word & HIGHS;
+}
+
+// Non-zero if any byte of the word equals the given byte.
+static constexpr uint64_t has_byte(uint64_t p_word, uint8_t p_byte) {
+	return has_zero(p_word ^ broadcast(p_byte));
+}
+
+// Non-zero if any byte of the word is outside the ASCII range.
+static constexpr uint64_t has_non_ascii(uint64_t p_word) {
+	return p_word & HIGHS;
+}
+
+} // namespace SWAR
@@ -43,6 +43,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, Object);
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "core/string/string_name.h"
+#include "core/string/swar.h"
 #include "core/string/translation_server.h"
 #include "core/string/ucaps.h"
 #include "core/variant/variant.h"
@@ -60,6 +61,30 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, Object);
 
 static const int MAX_DECIMALS = 32;
 
+// ASCII fast paths for the UTF-8 conversions, so plain ASCII text skips the per-character decoder.
+
+// Returns the length of the leading run of non-null ASCII bytes, rounded down to a multiple of 8.
+static _FORCE_INLINE_ int64_t _utf8_ascii_run_length(const uint8_t *p_src, int64_t p_len) {
+	int64_t i = 0;
+	while (i + 8 <= p_len) {
+		const uint64_t word = SWAR::load(p_src + i);
+		if (SWAR::has_non_ascii(word) || SWAR::has_zero(word)) {
+			break;
+		}
+		i += 8;
+	}
+	return i;
+}
+
+// Returns the length of the leading run of characters below 0x80, rounded down to a multiple of 4.
+static _FORCE_INLINE_ int _utf32_ascii_run_length(const char32_t *p_src, int p_len) {
+	int i = 0;
+	while (i + 4 <= p_len && (p_src[i] | p_src[i + 1] | p_src[i + 2] | p_src[i + 3]) < 0x80) {
+		i += 4;
+	}
+	return i;
+}
+
 static _FORCE_INLINE_ char32_t lower_case(char32_t c) {
 	return (is_ascii_upper_case(c) ? (c + ('a' - 'A')) : c);
 }
@@ -1767,6 +1792,18 @@ Error String::append_utf8(const char *p_utf8, int p_len) {
 	const uint8_t *ptr_limit = (uint8_t *)p_utf8 + p_len;
 
 	while (ptrtmp < ptr_limit && *ptrtmp) {
+		if (*ptrtmp < 0x80) {
+			const int64_t ascii_len = _utf8_ascii_run_length(ptrtmp, ptr_limit - ptrtmp);
+			if (ascii_len) {
+				for (int64_t i = 0; i < ascii_len; i++) {
+					dst[i] = ptrtmp[i];
+				}
+				dst += ascii_len;
+				ptrtmp += ascii_len;
+				continue;
+			}
+		}
+
 		uint8_t c = *ptrtmp;
 		uint32_t unicode = _replacement_char;
 		uint32_t size = 1;
@@ -1919,6 +1956,18 @@ CharString String::utf8(Vector<uint8_t> *r_ch_length_map) const {
 	const char32_t *d = &operator[](0);
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
+		const int ascii_len = _utf32_ascii_run_length(d + i, l - i);
+		if (ascii_len) {
+			fl += ascii_len;
+			if (map_ptr) {
+				memset(map_ptr + i, 1, ascii_len);
+			}
+			i += ascii_len;
+			if (i == l) {
+				break;
+			}
+		}
+
 		uint32_t c = d[i];
 		int ch_w = 1;
 		if (c <= 0x7f) { // 7 bits.
@@ -1956,6 +2005,18 @@ CharString String::utf8(Vector<uint8_t> *r_ch_length_map) const {
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
+		const int ascii_len = _utf32_ascii_run_length(d + i, l - i);
+		if (ascii_len) {
+			for (int j = 0; j < ascii_len; j++) {
+				cdst[j] = uint8_t(d[i + j]);
+			}
+			cdst += ascii_len;
+			i += ascii_len;
+			if (i == l) {
+				break;
+			}
+		}
+
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
@@ -2572,8 +2633,8 @@ done:
 #define READING_EXP 3
 #define READING_DONE 4
 
-double String::to_float(const char *p_str) {
-	return built_in_strtod<char>(p_str);
+double String::to_float(const char *p_str, const char **r_end) {
+	return built_in_strtod<char>(p_str, (char **)r_end);
 }
 
 double String::to_float(const char32_t *p_str, const char32_t **r_end) {
@@ -88,6 +88,14 @@ public:
 		spin_lock.unlock();
 	}
 
+	uint32_t get_page_size() const {
+		return page_size;
+	}
+
+	uint32_t get_pages_in_use() const {
+		return pages_allocated - pages_available;
+	}
+
 	uint32_t get_page_size_shift() const {
 		return Math::get_shift_from_power_of_2(page_size);
 	}
@@ -148,6 +148,10 @@ template <typename T>
 template <typename T1>
 constexpr int64_t Span<T>::find_sequence(const Span<T1> &p_span, uint64_t p_from) const {
 	for (uint64_t i = p_from; i <= size() - p_span.size(); i++) {
+		// Reject on the first element before comparing the whole sequence.
+		if (p_span.size() > 0 && ptr()[i] != p_span.ptr()[0]) {
+			continue;
+		}
 		if (are_spans_equal(ptr() + i, p_span.ptr(), p_span.size())) {
 			return i;
 		}
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  work_stealing_deque.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/typedefs.h"
+
+#include <atomic>
+
+// Bounded Chase-Lev work-stealing deque.
+// - The owner thread pushes and pops at the bottom (LIFO), without locking.
+// - Any other thread may steal from the top (FIFO), without locking.
+// - `push()` fails when the deque is full, so the caller can fall back to a shared queue.
+// Based on "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., 2013),
+// minus the buffer growth, which would need deferred reclamation.
+
+template <typename T, uint32_t CAPACITY = 256>
+class WorkStealingDeque {
+	static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of two.");
+	static_assert(std::atomic<T>::is_always_lock_free);
+
+	static constexpr int64_t MASK = CAPACITY - 1;
+
+	// Padded apart so thieves hammering `top` don't bounce the owner's cache line.
+	// Padding is used instead of `alignas` because this lives in containers
+	// that don't honor over-alignment.
+	std::atomic<int64_t> top = { 0 };
+	uint8_t _pad_top[64 - sizeof(std::atomic<int64_t>)] = {};
+	std::atomic<int64_t> bottom = { 0 };
+	uint8_t _pad_bottom[64 - sizeof(std::atomic<int64_t>)] = {};
+	std::atomic<T> buffer[CAPACITY];
+
+public:
+	// Owner thread only.
+	_FORCE_INLINE_ bool push(T p_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		if (b - t >= (int64_t)CAPACITY) {
+			return false;
+		}
+		buffer[b & MASK].store(p_value, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Owner thread only.
+	_FORCE_INLINE_ bool pop(T &r_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		T value = buffer[b & MASK].load(std::memory_order_relaxed);
+		if (t == b) {
+			// Last element, race against thieves for it.
+			bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			if (!won) {
+				return false;
+			}
+		}
+		r_value = value;
+		return true;
+	}
+
+	// Any thread. May fail spuriously if another thread took the top element concurrently;
+	// in that case `is_empty()` tells whether retrying makes sense.
+	_FORCE_INLINE_ bool steal(T &r_value) {
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t b = bottom.load(std::memory_order_acquire);
+		if (t >= b) {
+			return false;
+		}
+		T value = buffer[t & MASK].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return false;
+		}
+		r_value = value;
+		return true;
+	}
+
+	// Approximate when called concurrently with other operations.
+	_FORCE_INLINE_ uint32_t size() const {
+		int64_t b = bottom.load(std::memory_order_acquire);
+		int64_t t = top.load(std::memory_order_acquire);
+		return b > t ? (uint32_t)(b - t) : 0;
+	}
+
+	_FORCE_INLINE_ bool is_empty() const { return size() == 0; }
+
+	static constexpr uint32_t get_capacity() { return CAPACITY; }
+
+	WorkStealingDeque() {
+		for (uint32_t i = 0; i < CAPACITY; i++) {
+			buffer[i].store(T(), std::memory_order_relaxed);
+		}
+	}
+};
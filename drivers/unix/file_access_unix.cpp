@@ -36,6 +36,9 @@
 #include "core/string/print_string.h"
 
 #include <fcntl.h>
+#if !defined(WEB_ENABLED)
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -204,6 +207,14 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+#if !defined(WEB_ENABLED)
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+#endif
+
 	fclose(f);
 	f = nullptr;
 
@@ -309,6 +320,34 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::get_mapped_span() const {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+#if !defined(WEB_ENABLED)
+	if (mapped_data) {
+		return Span<uint8_t>(mapped_data, mapped_length);
+	}
+	if (flags & WRITE) {
+		return Span<uint8_t>(); // Only read-only files are mapped.
+	}
+
+	uint64_t length = get_length();
+	if (length == 0 || length > SIZE_MAX) {
+		return Span<uint8_t>();
+	}
+	void *data = mmap(nullptr, length, PROT_READ, MAP_SHARED, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return Span<uint8_t>(); // Not mappable (e.g. a pipe), callers fall back to get_buffer().
+	}
+
+	mapped_data = (uint8_t *)data;
+	mapped_length = length;
+	return Span<uint8_t>(mapped_data, mapped_length);
+#else
+	return Span<uint8_t>();
+#endif
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -225,6 +225,7 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->code = opcodes;
 		function->_code_ptr = &function->code.write[0];
 		function->_code_size = opcodes.size();
+		function->fusion_candidates = fusion_candidates;
 
 	} else {
 		function->_code_ptr = nullptr;
@@ -401,6 +402,11 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
 	function->_instruction_args_size = instr_args_max;
 
+	// Needs the operator function pointers, set above.
+	if (function->_code_ptr) {
+		function->_quicken();
+	}
+
 #ifdef DEBUG_ENABLED
 	function->operator_names = operator_names;
 	function->setter_names = setter_names;
@@ -564,6 +570,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 		append(Address());
 		append(p_target);
 		append(op_func);
+		last_validated_operator_end = opcodes.size();
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
@@ -584,6 +591,55 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_INT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::FLOAT && p_right_type == Variant::FLOAT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+			case Variant::OP_DIVIDE:
+				return GDScriptFunction::OPCODE_OPERATOR_DIVIDE_FLOAT;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::VECTOR3 && p_right_type == Variant::VECTOR3) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_VECTOR3;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_VECTOR3;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_VECTOR3;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::VECTOR3 && p_right_type == Variant::FLOAT) {
+		switch (p_operator) {
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT;
+			case Variant::OP_DIVIDE:
+				return GDScriptFunction::OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT;
+			default:
+				break;
+		}
+	}
+	return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	bool valid = HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand);
 
@@ -616,11 +672,18 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
-		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+		// The target must already hold the result type for typed operators, which is only ensured for temporaries.
+		GDScriptFunction::Opcode opcode = GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+		if (p_target.mode == Address::TEMPORARY) {
+			opcode = get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		}
+
+		append_opcode(opcode);
 		append(p_left_operand);
 		append(p_right_operand);
 		append(p_target);
 		append(op_func);
+		last_validated_operator_end = opcodes.size();
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
@@ -694,6 +757,7 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
 	append(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
@@ -701,6 +765,7 @@ void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_ope
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
 	append(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
@@ -724,6 +789,7 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
 	append(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
@@ -731,6 +797,7 @@ void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_oper
 }
 
 void GDScriptByteCodeGenerator::write_or_right_operand(const Address &p_right_operand) {
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
 	append(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
@@ -758,6 +825,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
 	append(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
@@ -996,7 +1064,24 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_source);
 		append(p_target.type.builtin_type);
 	} else {
-		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
+		add_fusion_candidate();
+		GDScriptFunction::Opcode opcode = GDScriptFunction::OPCODE_ASSIGN;
+		if (IS_BUILTIN_TYPE(p_target, p_source.type.builtin_type) && HAS_BUILTIN_TYPE(p_source)) {
+			switch (p_target.type.builtin_type) {
+				case Variant::INT:
+					opcode = GDScriptFunction::OPCODE_ASSIGN_INT;
+					break;
+				case Variant::FLOAT:
+					opcode = GDScriptFunction::OPCODE_ASSIGN_FLOAT;
+					break;
+				case Variant::VECTOR3:
+					opcode = GDScriptFunction::OPCODE_ASSIGN_VECTOR3;
+					break;
+				default:
+					break;
+			}
+		}
+		append_opcode(opcode);
 		append(p_target);
 		append(p_source);
 	}
@@ -1512,6 +1597,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
 	append(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
@@ -1787,6 +1873,7 @@ void GDScriptByteCodeGenerator::start_while_condition() {
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
+	add_fusion_candidate();
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
 	append(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
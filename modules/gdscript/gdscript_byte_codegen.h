@@ -100,6 +100,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 
+	// Where the last OPCODE_OPERATOR_VALIDATED ended, to spot instructions that can be fused with it.
+	int last_validated_operator_end = -1;
+	Vector<int> fusion_candidates;
+
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
@@ -381,6 +385,16 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(p_code);
 	}
 
+	// Opcode working on the raw values for the given operand types, or OPCODE_OPERATOR_VALIDATED if there's none.
+	static GDScriptFunction::Opcode get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type);
+
+	// Call right before appending an instruction that can run fused with a preceding validated operator.
+	void add_fusion_candidate() {
+		if (last_validated_operator_end == opcodes.size()) {
+			fusion_candidates.push_back(opcodes.size() - 5);
+		}
+	}
+
 	void append_opcode_and_argcount(GDScriptFunction::Opcode p_code, int p_argument_count) {
 		opcodes.push_back(p_code);
 		opcodes.push_back(p_argument_count);
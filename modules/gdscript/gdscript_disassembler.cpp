@@ -1302,6 +1302,67 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				DISASSEMBLE_TYPE_ADJUST(PACKED_COLOR_ARRAY);
 				DISASSEMBLE_TYPE_ADJUST(PACKED_VECTOR4_ARRAY);
 
+			// Superinstructions keep the layout of the original pair, so only the operator part is printed here.
+			// The fused assignment or jump that follows is disassembled as its own instruction.
+			case OPCODE_OPERATOR_VALIDATED_ASSIGN:
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF:
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT:
+			case OPCODE_ADD_INT_ASSIGN:
+			case OPCODE_SUBTRACT_INT_ASSIGN:
+			case OPCODE_JUMP_IF_NOT_INT_EQUAL:
+			case OPCODE_JUMP_IF_NOT_INT_NOT_EQUAL:
+			case OPCODE_JUMP_IF_NOT_INT_LESS:
+			case OPCODE_JUMP_IF_NOT_INT_LESS_EQUAL:
+			case OPCODE_JUMP_IF_NOT_INT_GREATER:
+			case OPCODE_JUMP_IF_NOT_INT_GREATER_EQUAL: {
+				text += "quickened operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+
+				incr += 5;
+			} break;
+
+			case OPCODE_OPERATOR_ADD_INT:
+			case OPCODE_OPERATOR_SUBTRACT_INT:
+			case OPCODE_OPERATOR_MULTIPLY_INT:
+			case OPCODE_OPERATOR_ADD_FLOAT:
+			case OPCODE_OPERATOR_SUBTRACT_FLOAT:
+			case OPCODE_OPERATOR_MULTIPLY_FLOAT:
+			case OPCODE_OPERATOR_DIVIDE_FLOAT:
+			case OPCODE_OPERATOR_ADD_VECTOR3:
+			case OPCODE_OPERATOR_SUBTRACT_VECTOR3:
+			case OPCODE_OPERATOR_MULTIPLY_VECTOR3:
+			case OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT:
+			case OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT: {
+				text += "typed operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+
+				incr += 5;
+			} break;
+			case OPCODE_ASSIGN_INT:
+			case OPCODE_ASSIGN_FLOAT:
+			case OPCODE_ASSIGN_VECTOR3: {
+				text += "assign typed ";
+				text += DADDR(1);
+				text += " = ";
+				text += DADDR(2);
+
+				incr += 3;
+			} break;
+
 			case OPCODE_ASSERT: {
 				text += "assert (";
 				text += DADDR(1);
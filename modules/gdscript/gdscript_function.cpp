@@ -104,6 +104,92 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+void GDScriptFunction::_quicken() {
+	// Runs once from the code generator, before the function can be called, so the code is never
+	// rewritten while another thread executes it.
+	// Only the opcode word of the validated operator is rewritten. The instruction it is fused with
+	// stays in place, so jumps landing on it (or resuming after an await) still run it on its own,
+	// and the code size doesn't change.
+	static const Variant::ValidatedOperatorEvaluator int_add = Variant::get_validated_operator_evaluator(Variant::OP_ADD, Variant::INT, Variant::INT);
+	static const Variant::ValidatedOperatorEvaluator int_subtract = Variant::get_validated_operator_evaluator(Variant::OP_SUBTRACT, Variant::INT, Variant::INT);
+	static const Variant::ValidatedOperatorEvaluator int_compares[] = {
+		Variant::get_validated_operator_evaluator(Variant::OP_EQUAL, Variant::INT, Variant::INT),
+		Variant::get_validated_operator_evaluator(Variant::OP_NOT_EQUAL, Variant::INT, Variant::INT),
+		Variant::get_validated_operator_evaluator(Variant::OP_LESS, Variant::INT, Variant::INT),
+		Variant::get_validated_operator_evaluator(Variant::OP_LESS_EQUAL, Variant::INT, Variant::INT),
+		Variant::get_validated_operator_evaluator(Variant::OP_GREATER, Variant::INT, Variant::INT),
+		Variant::get_validated_operator_evaluator(Variant::OP_GREATER_EQUAL, Variant::INT, Variant::INT),
+	};
+	static const Opcode int_compare_jumps[] = {
+		OPCODE_JUMP_IF_NOT_INT_EQUAL,
+		OPCODE_JUMP_IF_NOT_INT_NOT_EQUAL,
+		OPCODE_JUMP_IF_NOT_INT_LESS,
+		OPCODE_JUMP_IF_NOT_INT_LESS_EQUAL,
+		OPCODE_JUMP_IF_NOT_INT_GREATER,
+		OPCODE_JUMP_IF_NOT_INT_GREATER_EQUAL,
+	};
+	static_assert(std_size(int_compares) == std_size(int_compare_jumps));
+
+	for (int candidate : fusion_candidates) {
+		// Operator is 5 words long, the shortest instruction it can be fused with is 3.
+		ERR_CONTINUE(candidate < 0 || candidate + 8 > _code_size);
+		const int opcode = _code_ptr[candidate];
+		const bool typed_operator = opcode >= OPCODE_OPERATOR_ADD_INT && opcode <= OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT;
+		if (opcode != OPCODE_OPERATOR_VALIDATED && !typed_operator) {
+			continue;
+		}
+
+		int operator_idx = _code_ptr[candidate + 4];
+		ERR_CONTINUE(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+		Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+		int result_address = _code_ptr[candidate + 3];
+
+		const int next = candidate + 5;
+		Opcode fused = OPCODE_OPERATOR_VALIDATED;
+		switch (_code_ptr[next]) {
+			case OPCODE_ASSIGN:
+			case OPCODE_ASSIGN_INT:
+			case OPCODE_ASSIGN_FLOAT:
+			case OPCODE_ASSIGN_VECTOR3: {
+				// `a += b` compiles to the operator into a temporary, then an assignment from it.
+				bool assigns_result = _code_ptr[next + 2] == result_address;
+				if (assigns_result && operator_func == int_add) {
+					fused = OPCODE_ADD_INT_ASSIGN;
+				} else if (assigns_result && operator_func == int_subtract) {
+					fused = OPCODE_SUBTRACT_INT_ASSIGN;
+				} else {
+					fused = OPCODE_OPERATOR_VALIDATED_ASSIGN;
+				}
+			} break;
+			case OPCODE_JUMP_IF: {
+				fused = OPCODE_OPERATOR_VALIDATED_JUMP_IF;
+			} break;
+			case OPCODE_JUMP_IF_NOT: {
+				fused = OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+				if (_code_ptr[next + 1] == result_address) {
+					for (uint32_t i = 0; i < std_size(int_compares); i++) {
+						if (operator_func == int_compares[i]) {
+							fused = int_compare_jumps[i];
+							break;
+						}
+					}
+				}
+			} break;
+			default: {
+				// Not something the code generator marks as a candidate.
+				ERR_CONTINUE_MSG(true, "Unexpected instruction after validated operator in fusion candidate.");
+			} break;
+		}
+
+		// Typed operators are already cheaper than the generic fused forms, only int specializations are worth it.
+		if (typed_operator && (fused == OPCODE_OPERATOR_VALIDATED_ASSIGN || fused == OPCODE_OPERATOR_VALIDATED_JUMP_IF || fused == OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT)) {
+			continue;
+		}
+
+		_code_ptr[candidate] = fused;
+	}
+}
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
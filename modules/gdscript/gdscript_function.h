@@ -43,6 +43,10 @@
 class GDScriptInstance;
 class GDScript;
 
+namespace GDScriptTests {
+class TestGDScriptFunctionAccessor;
+}
+
 class GDScriptDataType {
 public:
 	Vector<GDScriptDataType> container_element_types;
@@ -417,6 +421,37 @@ public:
 		OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY,
 		OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY,
 		OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY,
+		// Superinstructions. Never emitted by the code generator, only written over an
+		// OPCODE_OPERATOR_VALIDATED by quickening. They run it together with the instruction
+		// that follows, keeping the operand layout of both.
+		OPCODE_OPERATOR_VALIDATED_ASSIGN,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_ADD_INT_ASSIGN,
+		OPCODE_SUBTRACT_INT_ASSIGN,
+		OPCODE_JUMP_IF_NOT_INT_EQUAL,
+		OPCODE_JUMP_IF_NOT_INT_NOT_EQUAL,
+		OPCODE_JUMP_IF_NOT_INT_LESS,
+		OPCODE_JUMP_IF_NOT_INT_LESS_EQUAL,
+		OPCODE_JUMP_IF_NOT_INT_GREATER,
+		OPCODE_JUMP_IF_NOT_INT_GREATER_EQUAL,
+		// Operators and assignments on typed values, working on the payload directly.
+		// Operators keep the OPCODE_OPERATOR_VALIDATED layout, evaluator index included.
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_OPERATOR_ADD_VECTOR3,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR3,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR3,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT,
+		OPCODE_ASSIGN_INT,
+		OPCODE_ASSIGN_FLOAT,
+		OPCODE_ASSIGN_VECTOR3,
 		OPCODE_ASSERT,
 		OPCODE_BREAKPOINT,
 		OPCODE_LINE,
@@ -455,6 +490,7 @@ private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
+	friend class GDScriptTests::TestGDScriptFunctionAccessor;
 
 	StringName name;
 	StringName source;
@@ -495,6 +531,9 @@ private:
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
 
+	// Positions of OPCODE_OPERATOR_VALIDATED directly followed by an instruction it can be fused with.
+	Vector<int> fusion_candidates;
+
 	int _code_size = 0;
 	int _default_arg_count = 0;
 	int _constant_count = 0;
@@ -567,6 +606,7 @@ private:
 	String _get_call_error(const String &p_where, const Variant **p_argptrs, int p_argcount, const Variant &p_ret, const Callable::CallError &p_err) const;
 	String _get_callable_call_error(const String &p_where, const Callable &p_callable, const Variant **p_argptrs, int p_argcount, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
+	void _quicken();
 
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
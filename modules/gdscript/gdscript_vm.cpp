@@ -407,6 +407,32 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY, \
 		&&OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY, \
 		&&OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY, \
+		&&OPCODE_OPERATOR_VALIDATED_ASSIGN, \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF, \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, \
+		&&OPCODE_ADD_INT_ASSIGN, \
+		&&OPCODE_SUBTRACT_INT_ASSIGN, \
+		&&OPCODE_JUMP_IF_NOT_INT_EQUAL, \
+		&&OPCODE_JUMP_IF_NOT_INT_NOT_EQUAL, \
+		&&OPCODE_JUMP_IF_NOT_INT_LESS, \
+		&&OPCODE_JUMP_IF_NOT_INT_LESS_EQUAL, \
+		&&OPCODE_JUMP_IF_NOT_INT_GREATER, \
+		&&OPCODE_JUMP_IF_NOT_INT_GREATER_EQUAL, \
+		&&OPCODE_OPERATOR_ADD_INT, \
+		&&OPCODE_OPERATOR_SUBTRACT_INT, \
+		&&OPCODE_OPERATOR_MULTIPLY_INT, \
+		&&OPCODE_OPERATOR_ADD_FLOAT, \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT, \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT, \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT, \
+		&&OPCODE_OPERATOR_ADD_VECTOR3, \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR3, \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3, \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT, \
+		&&OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT, \
+		&&OPCODE_ASSIGN_INT, \
+		&&OPCODE_ASSIGN_FLOAT, \
+		&&OPCODE_ASSIGN_VECTOR3, \
 		&&OPCODE_ASSERT, \
 		&&OPCODE_BREAKPOINT, \
 		&&OPCODE_LINE, \
@@ -3858,6 +3884,167 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE_TYPE_ADJUST(PACKED_COLOR_ARRAY, PackedColorArray);
 			OPCODE_TYPE_ADJUST(PACKED_VECTOR4_ARRAY, PackedVector4Array);
 
+			// Superinstructions: a validated operator (5 words) followed by the instruction it was fused with.
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_ASSIGN) {
+				CHECK_SPACE(8);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(result, 2);
+				operator_func(a, b, result);
+
+				GET_VARIANT_PTR(dst, 5);
+				GET_VARIANT_PTR(src, 6);
+				*dst = *src;
+
+				ip += 8;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF) {
+				CHECK_SPACE(8);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(result, 2);
+				operator_func(a, b, result);
+
+				GET_VARIANT_PTR(test, 5);
+				if (test->booleanize()) {
+					int to = _code_ptr[ip + 7];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 8;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(8);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(result, 2);
+				operator_func(a, b, result);
+
+				GET_VARIANT_PTR(test, 5);
+				if (!test->booleanize()) {
+					int to = _code_ptr[ip + 7];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 8;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			// Operand types were validated by the analyzer, same as for the validated operator they replace.
+			// The assignment target may still be untyped, so it only gets the fast path when it holds an int.
+#define OPCODE_INT_OPERATOR_ASSIGN(m_opcode, m_op) \
+	OPCODE(m_opcode) { \
+		CHECK_SPACE(8); \
+		GET_VARIANT_PTR(a, 0); \
+		GET_VARIANT_PTR(b, 1); \
+		GET_VARIANT_PTR(result, 2); \
+		GET_VARIANT_PTR(dst, 5); \
+		int64_t value = *VariantInternal::get_int(a) m_op *VariantInternal::get_int(b); \
+		*VariantInternal::get_int(result) = value; \
+		if (likely(dst->get_type() == Variant::INT)) { \
+			*VariantInternal::get_int(dst) = value; \
+		} else { \
+			*dst = *result; \
+		} \
+		ip += 8; \
+	} \
+	DISPATCH_OPCODE
+
+			OPCODE_INT_OPERATOR_ASSIGN(OPCODE_ADD_INT_ASSIGN, +);
+			OPCODE_INT_OPERATOR_ASSIGN(OPCODE_SUBTRACT_INT_ASSIGN, -);
+
+			// Only used when the jump tests the comparison result itself.
+#define OPCODE_JUMP_IF_NOT_INT_COMPARE(m_opcode, m_op) \
+	OPCODE(m_opcode) { \
+		CHECK_SPACE(8); \
+		GET_VARIANT_PTR(a, 0); \
+		GET_VARIANT_PTR(b, 1); \
+		GET_VARIANT_PTR(result, 2); \
+		bool value = *VariantInternal::get_int(a) m_op *VariantInternal::get_int(b); \
+		*VariantInternal::get_bool(result) = value; \
+		if (!value) { \
+			int to = _code_ptr[ip + 7]; \
+			GD_ERR_BREAK(to < 0 || to > _code_size); \
+			ip = to; \
+		} else { \
+			ip += 8; \
+		} \
+	} \
+	DISPATCH_OPCODE
+
+			OPCODE_JUMP_IF_NOT_INT_COMPARE(OPCODE_JUMP_IF_NOT_INT_EQUAL, ==);
+			OPCODE_JUMP_IF_NOT_INT_COMPARE(OPCODE_JUMP_IF_NOT_INT_NOT_EQUAL, !=);
+			OPCODE_JUMP_IF_NOT_INT_COMPARE(OPCODE_JUMP_IF_NOT_INT_LESS, <);
+			OPCODE_JUMP_IF_NOT_INT_COMPARE(OPCODE_JUMP_IF_NOT_INT_LESS_EQUAL, <=);
+			OPCODE_JUMP_IF_NOT_INT_COMPARE(OPCODE_JUMP_IF_NOT_INT_GREATER, >);
+			OPCODE_JUMP_IF_NOT_INT_COMPARE(OPCODE_JUMP_IF_NOT_INT_GREATER_EQUAL, >=);
+
+			// Operand types and the result temporary type are ensured by the code generator.
+#define OPCODE_OPERATOR_TYPED(m_opcode, m_left_type, m_right_type, m_result_type, m_op) \
+	OPCODE(m_opcode) { \
+		CHECK_SPACE(5); \
+		GET_VARIANT_PTR(a, 0); \
+		GET_VARIANT_PTR(b, 1); \
+		GET_VARIANT_PTR(dst, 2); \
+		*VariantInternal::get_##m_result_type(dst) = *VariantInternal::get_##m_left_type(a) m_op *VariantInternal::get_##m_right_type(b); \
+		ip += 5; \
+	} \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_ADD_INT, int, int, int, +);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_SUBTRACT_INT, int, int, int, -);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_MULTIPLY_INT, int, int, int, *);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_ADD_FLOAT, float, float, float, +);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_SUBTRACT_FLOAT, float, float, float, -);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_MULTIPLY_FLOAT, float, float, float, *);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_DIVIDE_FLOAT, float, float, float, /);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_ADD_VECTOR3, vector3, vector3, vector3, +);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_SUBTRACT_VECTOR3, vector3, vector3, vector3, -);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_MULTIPLY_VECTOR3, vector3, vector3, vector3, *);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT, vector3, float, vector3, *);
+			OPCODE_OPERATOR_TYPED(OPCODE_OPERATOR_DIVIDE_VECTOR3_FLOAT, vector3, float, vector3, /);
+
+			// A typed local may still hold something else before its first assignment (e.g. a reused stack slot).
+#define OPCODE_ASSIGN_TYPED(m_opcode, m_v_type, m_c_type) \
+	OPCODE(m_opcode) { \
+		CHECK_SPACE(3); \
+		GET_VARIANT_PTR(dst, 0); \
+		GET_VARIANT_PTR(src, 1); \
+		if (likely(dst->get_type() == Variant::m_v_type)) { \
+			*VariantInternal::get_##m_c_type(dst) = *VariantInternal::get_##m_c_type(src); \
+		} else { \
+			*dst = *src; \
+		} \
+		ip += 3; \
+	} \
+	DISPATCH_OPCODE
+
+			OPCODE_ASSIGN_TYPED(OPCODE_ASSIGN_INT, INT, int);
+			OPCODE_ASSIGN_TYPED(OPCODE_ASSIGN_FLOAT, FLOAT, float);
+			OPCODE_ASSIGN_TYPED(OPCODE_ASSIGN_VECTOR3, VECTOR3, vector3);
+
 			OPCODE(OPCODE_ASSERT) {
 				CHECK_SPACE(3);
 
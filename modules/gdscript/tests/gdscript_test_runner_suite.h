@@ -49,6 +49,18 @@ public:
 	}
 };
 
+class TestGDScriptFunctionAccessor {
+public:
+	static bool has_fused_opcode(const GDScriptFunction *p_function, GDScriptFunction::Opcode p_opcode) {
+		for (int candidate : p_function->fusion_candidates) {
+			if (p_function->_code_ptr[candidate] == p_opcode) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
 // TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
 #ifdef TOOLS_ENABLED
 TEST_SUITE("[Modules][GDScript]") {
@@ -85,6 +97,37 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Operators are fused into superinstructions when compiled") {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func sum_to(n: int) -> int:
+	var total := 0
+	var i := 0
+	while i < n:
+		total += i
+		i += 1
+	return total
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	const GDScriptFunction *const *function = gdscript->get_member_functions().getptr("sum_to");
+	REQUIRE(function != nullptr);
+	CHECK_MESSAGE(TestGDScriptFunctionAccessor::has_fused_opcode(*function, GDScriptFunction::OPCODE_ADD_INT_ASSIGN),
+			"`+=` on typed ints should be fused with its assignment.");
+	CHECK_MESSAGE(TestGDScriptFunctionAccessor::has_fused_opcode(*function, GDScriptFunction::OPCODE_JUMP_IF_NOT_INT_LESS),
+			"`<` on typed ints should be fused with the loop condition jump.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	CHECK(int(ref_counted->call("sum_to", 10)) == 45);
+}
+
 TEST_CASE("[Modules][GDScript] Loading keeps ResourceCache and GDScriptCache in sync") {
 	const String path = TestUtils::get_temp_path("gdscript_load_test.gd");
 
@@ -0,0 +1,39 @@
+# Operators followed by an assignment or a conditional jump are fused into
+# superinstructions at compile time, results must match the unfused ones.
+
+func sum_to(n: int) -> int:
+	var total := 0
+	var i := 0
+	while i < n:
+		total += i
+		i += 1
+	return total
+
+func count_down(n: int) -> int:
+	var steps := 0
+	while n > 0:
+		n -= 3
+		steps += 1
+	return steps
+
+func assign_untyped(n: int) -> Variant:
+	var value = 1.5
+	var k := 2
+	value = k + n
+	return value
+
+func compare(a: int, b: int) -> String:
+	if a < b:
+		return "less"
+	elif a == b:
+		return "equal"
+	elif a >= b + 2:
+		return "much greater"
+	return "greater"
+
+func test():
+	print(sum_to(10))
+	print(count_down(10))
+	var value = assign_untyped(10)
+	print(type_string(typeof(value)) + " " + str(value))
+	print(compare(1, 2) + ", " + compare(2, 2) + ", " + compare(3, 2) + ", " + compare(5, 2))
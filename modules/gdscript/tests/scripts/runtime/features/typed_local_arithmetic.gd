@@ -0,0 +1,26 @@
+func test():
+	var i := 7
+	var j := 3
+	var k := i + j
+	k = k - j * 2
+	k *= 5
+	print(k)
+
+	var f := 1.5
+	var g := 0.5
+	var h := f * g + f / g - g
+	print(h)
+
+	var a := Vector3(1, 2, 3)
+	var b := Vector3(4, 5, 6)
+	var c := a + b
+	c = c - a * b
+	c = c * 2.0 / 4.0
+	print(c)
+
+	# Stack slot reused with another type before the typed assignment.
+	for n in 2:
+		var s := "text"
+		print(s)
+	var reused := i * j
+	print(reused)
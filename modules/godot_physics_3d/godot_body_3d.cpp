@@ -671,17 +671,7 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	contact_count = 0;
 }
 
-void GodotBody3D::integrate_velocities(real_t p_step) {
-	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
-		return;
-	}
-
-	ERR_FAIL_NULL(get_space());
-
-	if (fi_callback_data || body_state_callback.is_valid()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
-
+void GodotBody3D::_apply_axis_lock() {
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
@@ -697,8 +687,22 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 			biased_angular_velocity[i] = 0;
 		}
 	}
+}
+
+void GodotBody3D::integrate_velocities(real_t p_step) {
+	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
+		return;
+	}
+
+	ERR_FAIL_NULL(get_space());
 
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		if (fi_callback_data || body_state_callback.is_valid()) {
+			get_space()->body_add_to_state_query_list(&direct_state_query_list);
+		}
+
+		_apply_axis_lock();
+
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.is_empty() && linear_velocity == Vector3() && angular_velocity == Vector3()) {
@@ -708,6 +712,15 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		return;
 	}
 
+	integrate_velocities_local(p_step);
+	integrate_velocities_commit();
+}
+
+void GodotBody3D::integrate_velocities_local(real_t p_step) {
+	ERR_FAIL_COND(mode < PhysicsServer3D::BODY_MODE_RIGID);
+
+	_apply_axis_lock();
+
 	Vector3 total_angular_velocity = angular_velocity + biased_angular_velocity;
 
 	real_t ang_vel = total_angular_velocity.length();
@@ -731,12 +744,23 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	transform_new.origin += total_linear_velocity * p_step;
 
-	_set_transform(transform_new);
+	// Shapes are updated in integrate_velocities_commit(), the broadphase can't be accessed from several threads.
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
 
 	_update_transform_dependent();
 }
 
+void GodotBody3D::integrate_velocities_commit() {
+	ERR_FAIL_NULL(get_space());
+
+	if (fi_callback_data || body_state_callback.is_valid()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	_update_shapes();
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
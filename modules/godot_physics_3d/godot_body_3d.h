@@ -146,6 +146,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	uint64_t island_step = 0;
 
 	void _update_transform_dependent();
+	void _apply_axis_lock();
 
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
@@ -319,6 +320,12 @@ public:
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
 
+	// Rigid bodies without continuous collision detection only touch their own state when integrating forces,
+	// and integrate_velocities() can be split so only the commit part touches the space.
+	_FORCE_INLINE_ bool can_integrate_in_parallel() const { return mode >= PhysicsServer3D::BODY_MODE_RIGID && !continuous_cd; }
+	void integrate_velocities_local(real_t p_step);
+	void integrate_velocities_commit();
+
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
 	}
@@ -37,6 +37,8 @@
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
@@ -110,14 +112,17 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	return _intersect_ray_candidates(p_parameters, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_candidates(const RayParameters &p_parameters, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) const {
 	Vector3 begin, end;
 	Vector3 normal;
 	begin = p_parameters.from;
 	end = p_parameters.to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -127,22 +132,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_objects[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_subindices[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -218,30 +223,33 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
 
 	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	return _intersect_shape_candidates(p_parameters, shape, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_results, p_result_max);
+}
 
+int GodotPhysicsDirectSpaceState3D::_intersect_shape_candidates(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, ShapeResult *r_results, int p_result_max) const {
 	int cc = 0;
 
 	//Transform3D ai = p_xform.affine_inverse();
 
-	for (int i = 0; i < amount; i++) {
+	for (int i = 0; i < p_amount; i++) {
 		if (cc >= p_result_max) {
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
+		int shape_idx = p_subindices[i];
 
-		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
+		if (!GodotCollisionSolver3D::solve_static(p_shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
 		}
 
@@ -262,6 +270,187 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+// Up to 4 rays culled together: one broadphase query for their combined bounds,
+// then every candidate is tested against all rays at once with a slab test.
+struct GodotRayPacket3D {
+	static constexpr int SIZE = 4;
+
+	real_t origin[3][SIZE];
+	real_t inv_dir[3][SIZE];
+	int count = 0;
+	AABB bounds;
+	real_t max_length = 0.0;
+
+	void setup(const PhysicsDirectSpaceState3D::RayParameters *p_rays, int p_count) {
+		count = p_count;
+		bounds = AABB(p_rays[0].from, Vector3());
+		max_length = 0.0;
+		for (int lane = 0; lane < SIZE; lane++) {
+			// Unused lanes repeat the first ray, their results are masked out.
+			const PhysicsDirectSpaceState3D::RayParameters &ray = p_rays[lane < p_count ? lane : 0];
+			const Vector3 dir = ray.to - ray.from;
+			for (int axis = 0; axis < 3; axis++) {
+				origin[axis][lane] = ray.from[axis];
+				// Large instead of infinite, so the slab test never computes 0 * inf.
+				inv_dir[axis][lane] = dir[axis] == 0.0 ? (real_t)1e30 : (real_t)1.0 / dir[axis];
+			}
+			bounds.expand_to(ray.from);
+			bounds.expand_to(ray.to);
+			max_length = MAX(max_length, dir.length());
+		}
+	}
+
+	// Rays spread far apart would pull most of the space into the combined bounds.
+	_FORCE_INLINE_ bool is_coherent() const {
+		return count > 1 && bounds.size.length() <= max_length * 2.0;
+	}
+
+	// Bit per ray whose segment overlaps p_aabb. Lanes are independent so this loop vectorizes.
+	_FORCE_INLINE_ uint32_t test_aabb(const AABB &p_aabb) const {
+		const Vector3 min = p_aabb.position;
+		const Vector3 max = p_aabb.position + p_aabb.size;
+		uint32_t mask = 0;
+		for (int lane = 0; lane < SIZE; lane++) {
+			real_t t_enter = 0.0;
+			real_t t_exit = 1.0;
+			for (int axis = 0; axis < 3; axis++) {
+				const real_t t0 = (min[axis] - origin[axis][lane]) * inv_dir[axis][lane];
+				const real_t t1 = (max[axis] - origin[axis][lane]) * inv_dir[axis][lane];
+				t_enter = MAX(t_enter, MIN(t0, t1));
+				t_exit = MIN(t_exit, MAX(t0, t1));
+			}
+			mask |= uint32_t(t_enter <= t_exit) << lane;
+		}
+		return mask & ((1u << count) - 1);
+	}
+};
+
+void GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch) {
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+
+	// The space's own result buffers are shared, each chunk gets its own.
+	LocalVector<GodotCollisionObject3D *> objects;
+	objects.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> subindices;
+	subindices.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<uint32_t> masks;
+	LocalVector<GodotCollisionObject3D *> ray_objects;
+	LocalVector<int> ray_subindices;
+
+	int hit_count = 0;
+	for (int packet_begin = begin; packet_begin < end; packet_begin += GodotRayPacket3D::SIZE) {
+		const int packet_size = MIN(GodotRayPacket3D::SIZE, end - packet_begin);
+		const RayParameters *rays = p_batch->parameters + packet_begin;
+		RayResult *results = p_batch->results + packet_begin;
+		bool *hits = p_batch->hits + packet_begin;
+
+		GodotRayPacket3D packet;
+		packet.setup(rays, packet_size);
+
+		int amount = -1;
+		if (packet.is_coherent()) {
+			amount = space->broadphase->cull_aabb(packet.bounds, objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, subindices.ptr());
+			if (amount >= GodotSpace3D::INTERSECTION_QUERY_MAX) {
+				amount = -1; // May be truncated, which would lose hits.
+			}
+		}
+
+		if (amount < 0) {
+			for (int i = 0; i < packet_size; i++) {
+				int ray_amount = space->broadphase->cull_segment(rays[i].from, rays[i].to, objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, subindices.ptr());
+				hits[i] = _intersect_ray_candidates(rays[i], objects.ptr(), subindices.ptr(), ray_amount, results[i]);
+				hit_count += hits[i] ? 1 : 0;
+			}
+			continue;
+		}
+
+		masks.resize(amount);
+		for (int i = 0; i < amount; i++) {
+			masks[i] = packet.test_aabb(objects[i]->get_shape_aabb(subindices[i]));
+		}
+
+		for (int lane = 0; lane < packet_size; lane++) {
+			ray_objects.clear();
+			ray_subindices.clear();
+			for (int i = 0; i < amount; i++) {
+				if (masks[i] & (1u << lane)) {
+					ray_objects.push_back(objects[i]);
+					ray_subindices.push_back(subindices[i]);
+				}
+			}
+			hits[lane] = _intersect_ray_candidates(rays[lane], ray_objects.ptr(), ray_subindices.ptr(), ray_objects.size(), results[lane]);
+			hit_count += hits[lane] ? 1 : 0;
+		}
+	}
+
+	p_batch->hit_count.add(hit_count);
+}
+
+int GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters *p_parameters, int p_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND_V(space->locked, 0);
+
+	RayBatch batch;
+	batch.parameters = p_parameters;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	const uint32_t chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk, &batch, chunk_count, -1, true, SNAME("Physics3DIntersectRays"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_intersect_ray_batch_chunk(0, &batch);
+	}
+
+	return batch.hit_count.get();
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_shape_batch_chunk(uint32_t p_chunk, ShapeBatch *p_batch) {
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+
+	LocalVector<GodotCollisionObject3D *> objects;
+	objects.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> subindices;
+	subindices.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+
+	for (int i = begin; i < end; i++) {
+		const ShapeParameters &parameters = p_batch->parameters[i];
+		p_batch->result_counts[i] = 0;
+		if (p_batch->result_max <= 0) {
+			continue;
+		}
+
+		const GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(parameters.shape_rid);
+		ERR_CONTINUE(!shape);
+
+		AABB aabb = parameters.transform.xform(shape->get_aabb());
+		int amount = space->broadphase->cull_aabb(aabb, objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, subindices.ptr());
+		p_batch->result_counts[i] = _intersect_shape_candidates(parameters, shape, objects.ptr(), subindices.ptr(), amount, p_batch->results + i * p_batch->result_max, p_batch->result_max);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters *p_parameters, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ERR_FAIL_COND(space->locked);
+
+	ShapeBatch batch;
+	batch.parameters = p_parameters;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+
+	const uint32_t chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_shape_batch_chunk, &batch, chunk_count, -1, true, SNAME("Physics3DIntersectShapes"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_intersect_shape_batch_chunk(0, &batch);
+	}
+}
+
 bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
 	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_NULL_V(shape, false);
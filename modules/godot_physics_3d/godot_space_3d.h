@@ -41,6 +41,30 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	// Queries handled by one worker thread task in batched calls.
+	static constexpr int BATCH_CHUNK_SIZE = 64;
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+		SafeNumeric<int> hit_count;
+	};
+
+	struct ShapeBatch {
+		const ShapeParameters *parameters = nullptr;
+		int count = 0;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+	};
+
+	bool _intersect_ray_candidates(const RayParameters &p_parameters, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) const;
+	int _intersect_shape_candidates(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, ShapeResult *r_results, int p_result_max) const;
+	void _intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch);
+	void _intersect_shape_batch_chunk(uint32_t p_chunk, ShapeBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -52,6 +76,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
 
+	virtual int intersect_rays(const RayParameters *p_parameters, int p_count, RayResult *r_results, bool *r_hits) override;
+	virtual void intersect_shapes(const ShapeParameters *p_parameters, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
+
 	GodotPhysicsDirectSpaceState3D();
 };
 
@@ -40,6 +40,9 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define PARALLEL_BODY_COUNT_RESERVE 1024
+// Below this, waking up worker threads costs more than integrating the bodies.
+#define PARALLEL_BODY_COUNT_MIN 128
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -112,6 +115,27 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	parallel_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	parallel_bodies[p_body_index]->integrate_velocities_local(delta);
+}
+
+void GodotStep3D::_run_parallel_bodies(void (GodotStep3D::*p_method)(uint32_t, void *), const StringName &p_name) {
+	uint32_t body_count = parallel_bodies.size();
+	if (body_count < PARALLEL_BODY_COUNT_MIN) {
+		for (uint32_t body_index = 0; body_index < body_count; ++body_index) {
+			(this->*p_method)(body_index, nullptr);
+		}
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, nullptr, body_count, -1, true, p_name);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -203,13 +227,22 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	int active_count = 0;
 
+	// Bodies which may move their shapes in the broadphase are integrated right away, the others in parallel.
+	parallel_bodies.clear();
 	const SelfList<GodotBody3D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		GodotBody3D *body = b->self();
+		if (body->can_integrate_in_parallel()) {
+			parallel_bodies.push_back(body);
+		} else {
+			body->integrate_forces(p_delta);
+		}
 		b = b->next();
 		active_count++;
 	}
 
+	_run_parallel_bodies(&GodotStep3D::_integrate_forces, SNAME("Physics3DIntegrateForces"));
+
 	/* UPDATE SOFT BODY MOTION */
 
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
@@ -375,13 +408,27 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
+	// Kinematic bodies can deactivate themselves here, which removes them from the list.
+	parallel_bodies.clear();
 	b = body_list->first();
 	while (b) {
 		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
+		GodotBody3D *body = b->self();
+		if (body->get_mode() >= PhysicsServer3D::BODY_MODE_RIGID) {
+			parallel_bodies.push_back(body);
+		} else {
+			body->integrate_velocities(p_delta);
+		}
 		b = n;
 	}
 
+	_run_parallel_bodies(&GodotStep3D::_integrate_velocities, SNAME("Physics3DIntegrateVelocities"));
+
+	// Broadphase updates stay serial and in list order, so pairs are found the same way on every run.
+	for (GodotBody3D *body : parallel_bodies) {
+		body->integrate_velocities_commit();
+	}
+
 	/* SLEEP / WAKE UP ISLANDS */
 
 	for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
@@ -412,6 +459,7 @@ GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	parallel_bodies.reserve(PARALLEL_BODY_COUNT_RESERVE);
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  test_godot_space_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotSpace3D {
+
+TEST_CASE("[Physics3D] Batched ray queries match single ray queries") {
+	GodotPhysicsServer3D *ps = memnew(GodotPhysicsServer3D);
+	ps->init();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	LocalVector<RID> boxes;
+	for (int x = 0; x < 10; x++) {
+		for (int z = 0; z < 10; z++) {
+			RID box = ps->body_create();
+			ps->body_set_mode(box, PhysicsServer3D::BODY_MODE_STATIC);
+			ps->body_add_shape(box, box_shape);
+			ps->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 2.0, (x + z) % 3, z * 2.0)));
+			ps->body_set_space(box, space);
+			boxes.push_back(box);
+		}
+	}
+	// Shapes are registered in the broadphase when stepping.
+	ps->step(1.0 / 60.0);
+
+	// Coherent fans of rays from a few origins, plus rays spread over the whole grid.
+	LocalVector<PhysicsDirectSpaceState3D::RayParameters> rays;
+	for (int i = 0; i < 200; i++) {
+		PhysicsDirectSpaceState3D::RayParameters ray;
+		if (i % 2 == 0) {
+			ray.from = Vector3((i / 16) * 1.5, 5.0, (i / 16) * 1.5);
+			ray.to = ray.from + Vector3(Math::cos(i * 0.3) * 3.0, -8.0, Math::sin(i * 0.3) * 3.0);
+		} else {
+			ray.from = Vector3(-1.0, 0.5, (i % 20) * 1.0);
+			ray.to = Vector3(21.0, 0.5 + (i % 3), 19.0 - (i % 20) * 1.0);
+		}
+		rays.push_back(ray);
+	}
+
+	PhysicsDirectSpaceState3D *space_state = ps->space_get_direct_state(space);
+	REQUIRE(space_state != nullptr);
+
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(rays.size());
+	LocalVector<bool> hits;
+	hits.resize(rays.size());
+	int hit_count = space_state->intersect_rays(rays.ptr(), rays.size(), results.ptr(), hits.ptr());
+	CHECK(hit_count > 0);
+
+	int expected_hit_count = 0;
+	bool all_match = true;
+	for (uint32_t i = 0; i < rays.size(); i++) {
+		PhysicsDirectSpaceState3D::RayResult expected;
+		bool expected_hit = space_state->intersect_ray(rays[i], expected);
+		expected_hit_count += expected_hit ? 1 : 0;
+		all_match = all_match && expected_hit == hits[i];
+		if (expected_hit && hits[i]) {
+			all_match = all_match && expected.rid == results[i].rid && expected.position.is_equal_approx(results[i].position);
+		}
+	}
+	CHECK(hit_count == expected_hit_count);
+	CHECK_MESSAGE(all_match, "Every ray of the batch should hit the same object at the same position as when queried alone.");
+
+	for (const RID &box : boxes) {
+		ps->free_rid(box);
+	}
+	ps->free_rid(box_shape);
+	ps->free_rid(space);
+
+	ps->finish();
+	memdelete(ps);
+}
+
+} // namespace TestGodotSpace3D
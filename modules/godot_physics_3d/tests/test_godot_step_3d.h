@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  test_godot_step_3d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotStep3D {
+
+// A grid of spheres dropped on a static floor, enough to go through the parallel integration path.
+// Runs on its own GodotPhysicsServer3D, regardless of the physics engine selected for the project.
+struct FallingSpheres {
+	GodotPhysicsServer3D *ps = nullptr;
+	RID space;
+	RID floor_shape;
+	RID floor;
+	RID sphere_shape;
+	LocalVector<RID> bodies;
+
+	FallingSpheres(int p_side) {
+		ps = memnew(GodotPhysicsServer3D);
+		ps->init();
+
+		space = ps->space_create();
+		ps->space_set_active(space, true);
+
+		floor_shape = ps->box_shape_create();
+		ps->shape_set_data(floor_shape, Vector3(p_side * 2.0, 1.0, p_side * 2.0));
+		floor = ps->body_create();
+		ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_add_shape(floor, floor_shape);
+		ps->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+		ps->body_set_space(floor, space);
+
+		sphere_shape = ps->sphere_shape_create();
+		ps->shape_set_data(sphere_shape, 0.5);
+		for (int x = 0; x < p_side; x++) {
+			for (int z = 0; z < p_side; z++) {
+				for (int y = 0; y < 4; y++) {
+					RID body = ps->body_create();
+					ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+					ps->body_add_shape(body, sphere_shape);
+					// Slightly staggered so spheres don't rest perfectly on top of each other.
+					Vector3 origin(x * 1.5 - p_side * 0.75 + y * 0.1, 1.0 + y * 1.5, z * 1.5 - p_side * 0.75);
+					ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), origin));
+					ps->body_set_space(body, space);
+					bodies.push_back(body);
+				}
+			}
+		}
+	}
+
+	void step(int p_frames) {
+		for (int i = 0; i < p_frames; i++) {
+			ps->step(1.0 / 60.0);
+			ps->sync();
+			ps->flush_queries();
+			ps->end_sync();
+		}
+	}
+
+	LocalVector<Vector3> get_positions() const {
+		LocalVector<Vector3> positions;
+		for (const RID &body : bodies) {
+			Transform3D transform = ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+			positions.push_back(transform.origin);
+		}
+		return positions;
+	}
+
+	~FallingSpheres() {
+		for (const RID &body : bodies) {
+			ps->free_rid(body);
+		}
+		ps->free_rid(floor);
+		ps->free_rid(sphere_shape);
+		ps->free_rid(floor_shape);
+		ps->free_rid(space);
+
+		ps->finish();
+		memdelete(ps);
+	}
+};
+
+TEST_CASE("[Physics3D] Simulation is deterministic across runs") {
+	LocalVector<Vector3> first;
+	LocalVector<Vector3> second;
+	{
+		FallingSpheres scene(8);
+		scene.step(90);
+		first = scene.get_positions();
+	}
+	{
+		FallingSpheres scene(8);
+		scene.step(90);
+		second = scene.get_positions();
+	}
+
+	REQUIRE(first.size() == 8 * 8 * 4);
+	REQUIRE(first.size() == second.size());
+	bool identical = true;
+	bool above_floor = true;
+	for (uint32_t i = 0; i < first.size(); i++) {
+		identical = identical && first[i] == second[i];
+		above_floor = above_floor && first[i].y > 0.0;
+	}
+	CHECK_MESSAGE(identical, "Bodies should end up at the same positions when stepping the same scene twice.");
+	CHECK_MESSAGE(above_floor, "Bodies should rest on the floor.");
+}
+
+TEST_CASE_PENDING("[Physics3D][Benchmark] Step 10k rigid bodies") {
+	FallingSpheres scene(50); // 50 * 50 * 4 bodies.
+	REQUIRE(scene.bodies.size() == 10000);
+
+	// Let the pile settle into contact first, so most frames have active narrowphase work.
+	scene.step(10);
+
+	const int frames = 60;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	scene.step(frames);
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Stepped %d rigid bodies for %d frames: %.3f ms per frame.", scene.bodies.size(), frames, elapsed / 1000.0 / frames));
+}
+
+} // namespace TestGodotStep3D
@@ -44,6 +44,8 @@
 #include "jolt_query_filter_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "Jolt/Geometry/GJKClosestPoint.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyFilter.h"
@@ -466,6 +468,46 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 
 	space->flush_pending_objects();
 
+	return _intersect_ray(p_parameters, r_result);
+}
+
+void JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch) {
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+
+	int hit_count = 0;
+	for (int i = begin; i < end; i++) {
+		p_batch->hits[i] = _intersect_ray(p_batch->parameters[i], p_batch->results[i]);
+		hit_count += p_batch->hits[i] ? 1 : 0;
+	}
+
+	p_batch->hit_count.add(hit_count);
+}
+
+int JoltPhysicsDirectSpaceState3D::intersect_rays(const RayParameters *p_parameters, int p_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), 0, "intersect_rays must not be called while the physics space is being stepped.");
+
+	// Only done once up front, the queries themselves are safe to run concurrently.
+	space->flush_pending_objects();
+
+	RayBatch batch;
+	batch.parameters = p_parameters;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	const uint32_t chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk, &batch, chunk_count, -1, true, SNAME("JoltIntersectRays"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (chunk_count == 1) {
+		_intersect_ray_batch_chunk(0, &batch);
+	}
+
+	return batch.hit_count.get();
+}
+
+bool JoltPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
 
 	const JPH::RVec3 from = to_jolt_r(p_parameters.from);
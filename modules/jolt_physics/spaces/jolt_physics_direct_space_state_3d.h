@@ -51,8 +51,22 @@ class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3D {
 
 	JoltSpace3D *space = nullptr;
 
+	// Rays handled by one worker thread task in batched calls.
+	static constexpr int BATCH_CHUNK_SIZE = 64;
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+		SafeNumeric<int> hit_count;
+	};
+
 	static void _bind_methods() {}
 
+	bool _intersect_ray(const RayParameters &p_parameters, RayResult &r_result);
+	void _intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch);
+
 	bool _cast_motion_impl(const JPH::Shape &p_jolt_shape, const Transform3D &p_transform_com, const Vector3 &p_scale, const Vector3 &p_motion, bool p_use_edge_removal, bool p_ignore_overlaps, const JPH::CollideShapeSettings &p_settings, const JPH::BroadPhaseLayerFilter &p_broad_phase_layer_filter, const JPH::ObjectLayerFilter &p_object_layer_filter, const JPH::BodyFilter &p_body_filter, const JPH::ShapeFilter &p_shape_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const;
 
 	bool _body_motion_recover(const JoltBody3D &p_body, const Transform3D &p_transform, float p_margin, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, Vector3 &r_recovery) const;
@@ -71,6 +85,7 @@ public:
 	explicit JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_space);
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual int intersect_rays(const RayParameters *p_parameters, int p_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &r_closest_safe, real_t &r_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
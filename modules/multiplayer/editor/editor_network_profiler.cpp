@@ -54,6 +54,7 @@ void EditorNetworkProfiler::_notification(int p_what) {
 			up_label->set_text(TTR("Up", "Network"));
 
 			set_bandwidth(incoming_bandwidth, outgoing_bandwidth);
+			set_batching(batched_messages, batch_packets, multi_message_packets);
 
 			if (is_ready()) {
 				refresh_rpc_data();
@@ -237,6 +238,8 @@ void EditorNetworkProfiler::_clear_pressed() {
 	node_data.clear();
 	missing_node_data.clear();
 	set_bandwidth(0, 0);
+	set_batching(0, 0, 0);
+	batching_text->hide();
 	refresh_rpc_data();
 	refresh_replication_data();
 	clear_button->set_disabled(true);
@@ -312,6 +315,18 @@ void EditorNetworkProfiler::set_bandwidth(int p_incoming, int p_outgoing) {
 			theme_cache.outgoing_bandwidth_color * Color(1, 1, 1, p_outgoing > 0 ? 1 : 0.5));
 }
 
+void EditorNetworkProfiler::set_batching(int p_messages, int p_packets, int p_batched_packets) {
+	batched_messages = p_messages;
+	batch_packets = p_packets;
+	multi_message_packets = p_batched_packets;
+
+	// Only shown once the game reports outgoing packets.
+	if (p_packets > 0) {
+		batching_text->show();
+	}
+	batching_text->set_text(vformat(TTR("%d msg in %d pkt/s (%d batched)"), p_messages, p_packets, p_batched_packets));
+}
+
 bool EditorNetworkProfiler::is_profiling() {
 	return activate->is_pressed();
 }
@@ -377,6 +392,15 @@ EditorNetworkProfiler::EditorNetworkProfiler() {
 	outgoing_bandwidth_text->set_accessibility_name(TTRC("Outgoing Bandwidth"));
 	hb->add_child(outgoing_bandwidth_text);
 
+	batching_text = memnew(LineEdit);
+	batching_text->set_editable(false);
+	batching_text->set_custom_minimum_size(Size2(160, 0) * EDSCALE);
+	batching_text->set_horizontal_alignment(HORIZONTAL_ALIGNMENT_RIGHT);
+	batching_text->set_accessibility_name(TTRC("Batched Messages"));
+	batching_text->set_tooltip_text(TTRC("Outgoing messages and the packets they were sent in, per second. Batched packets carry more than one message."));
+	batching_text->hide();
+	hb->add_child(batching_text);
+
 	HSplitContainer *sc = memnew(HSplitContainer);
 	add_child(sc);
 	sc->set_v_size_flags(SIZE_EXPAND_FILL);
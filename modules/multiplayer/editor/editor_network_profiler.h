@@ -68,6 +68,7 @@ private:
 	Tree *counters_display = nullptr;
 	LineEdit *incoming_bandwidth_text = nullptr;
 	LineEdit *outgoing_bandwidth_text = nullptr;
+	LineEdit *batching_text = nullptr;
 	Tree *replication_display = nullptr;
 
 	Label *up_label = nullptr;
@@ -75,6 +76,9 @@ private:
 
 	int incoming_bandwidth = 0;
 	int outgoing_bandwidth = 0;
+	int batched_messages = 0;
+	int batch_packets = 0;
+	int multi_message_packets = 0;
 
 	HashMap<ObjectID, RPCNodeInfo> rpc_data;
 	HashMap<ObjectID, SyncInfo> sync_data;
@@ -119,6 +123,7 @@ public:
 	void add_rpc_frame_data(const RPCNodeInfo &p_frame);
 	void add_sync_frame_data(const SyncInfo &p_frame);
 	void set_bandwidth(int p_incoming, int p_outgoing);
+	void set_batching(int p_messages, int p_packets, int p_batched_packets);
 	bool is_profiling();
 
 	void set_profiling(bool p_pressed);
@@ -86,6 +86,10 @@ bool MultiplayerEditorDebugger::capture(const String &p_message, const Array &p_
 		ERR_FAIL_COND_V(p_data.size() < 2, false);
 		profiler->set_bandwidth(p_data[0], p_data[1]);
 		return true;
+	} else if (p_message == "multiplayer:batching") {
+		ERR_FAIL_COND_V(p_data.size() < 3, false);
+		profiler->set_batching(p_data[0], p_data[1], p_data[2]);
+		return true;
 	}
 	return false;
 }
@@ -96,6 +100,7 @@ void MultiplayerEditorDebugger::_profiler_activate(bool p_enable, int p_session_
 	session->toggle_profiler("multiplayer:bandwidth", p_enable);
 	session->toggle_profiler("multiplayer:rpc", p_enable);
 	session->toggle_profiler("multiplayer:replication", p_enable);
+	session->toggle_profiler("multiplayer:batching", p_enable);
 }
 
 void MultiplayerEditorDebugger::setup_session(int p_session_id) {
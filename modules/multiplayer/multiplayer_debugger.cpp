@@ -55,6 +55,11 @@ void MultiplayerDebugger::initialize() {
 	replication_profiler->bind("multiplayer:replication");
 	multiplayer_profilers.push_back(replication_profiler);
 
+	Ref<BatchingProfiler> batching_profiler;
+	batching_profiler.instantiate();
+	batching_profiler->bind("multiplayer:batching");
+	multiplayer_profilers.push_back(batching_profiler);
+
 	EngineDebugger::register_message_capture("multiplayer", EngineDebugger::Capture(nullptr, &_capture));
 }
 
@@ -328,3 +333,35 @@ void MultiplayerDebugger::ReplicationProfiler::tick(double p_frame_time, double
 		EngineDebugger::get_singleton()->send_message("multiplayer:syncs", frame.serialize());
 	}
 }
+
+// BatchingProfiler
+
+void MultiplayerDebugger::BatchingProfiler::toggle(bool p_enable, const Array &p_opts) {
+	messages = 0;
+	packets = 0;
+	batched_packets = 0;
+	last_profile_time = 0;
+}
+
+void MultiplayerDebugger::BatchingProfiler::add(const Array &p_data) {
+	ERR_FAIL_COND(p_data.size() != 1);
+	const int count = p_data[0];
+	messages += count;
+	packets++;
+	if (count > 1) {
+		batched_packets++;
+	}
+}
+
+void MultiplayerDebugger::BatchingProfiler::tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+	uint64_t pt = OS::get_singleton()->get_ticks_msec();
+	if (pt - last_profile_time > 1000) {
+		last_profile_time = pt;
+		// Totals over the last second: messages sent, packets carrying them, and packets carrying more than one message.
+		Array arr = { messages, packets, batched_packets };
+		messages = 0;
+		packets = 0;
+		batched_packets = 0;
+		EngineDebugger::get_singleton()->send_message("multiplayer:batching", arr);
+	}
+}
@@ -127,6 +127,21 @@ private:
 		void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
 	};
 
+	class BatchingProfiler : public EngineProfiler {
+		GDSOFTCLASS(BatchingProfiler, EngineProfiler);
+
+	private:
+		int messages = 0;
+		int packets = 0;
+		int batched_packets = 0;
+		uint64_t last_profile_time = 0;
+
+	public:
+		void toggle(bool p_enable, const Array &p_opts) override;
+		void add(const Array &p_data) override;
+		void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
+	};
+
 	static Error _capture(void *p_user, const String &p_msg, const Array &p_args, bool &r_captured);
 
 public:
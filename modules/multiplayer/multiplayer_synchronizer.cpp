@@ -110,6 +110,7 @@ void MultiplayerSynchronizer::reset() {
 	last_watch_usec = 0;
 	sync_started = false;
 	watchers.clear();
+	delta_baselines.clear();
 }
 
 uint32_t MultiplayerSynchronizer::get_net_id() const {
@@ -242,6 +243,19 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_interest_radius(real_t p_radius) {
+	ERR_FAIL_COND_MSG(!Math::is_finite(p_radius) || p_radius < 0, "Interest radius must be finite and greater or equal to 0 (where 0 disables interest management)");
+	if (interest_radius == p_radius) {
+		return;
+	}
+	interest_radius = p_radius;
+	update_visibility(0);
+}
+
+real_t MultiplayerSynchronizer::get_interest_radius() const {
+	return interest_radius;
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -267,12 +281,16 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
+	ClassDB::bind_method(D_METHOD("set_interest_radius", "radius"), &MultiplayerSynchronizer::set_interest_radius);
+	ClassDB::bind_method(D_METHOD("get_interest_radius"), &MultiplayerSynchronizer::get_interest_radius);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "delta_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_delta_interval", "get_delta_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, SceneReplicationConfig::get_class_static(), PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_radius", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater"), "set_interest_radius", "get_interest_radius");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
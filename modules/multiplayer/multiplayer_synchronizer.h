@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "scene_replication_codec.h"
 #include "scene_replication_config.h"
 
 #include "scene/main/node.h"
@@ -58,7 +59,9 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	real_t interest_radius = 0;
 	Vector<Watcher> watchers;
+	LocalVector<SceneReplicationCodec::Baseline> delta_baselines;
 	uint64_t last_watch_usec = 0;
 
 	ObjectID root_node_cache;
@@ -115,9 +118,12 @@ public:
 	void add_visibility_filter(Callable p_callback);
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
+	void set_interest_radius(real_t p_radius);
+	real_t get_interest_radius() const;
 
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
+	LocalVector<SceneReplicationCodec::Baseline> &get_delta_baselines() { return delta_baselines; }
 	SceneReplicationConfig *get_replication_config_ptr() const;
 
 	MultiplayerSynchronizer();
@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*  scene_interest_grid.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_interest_grid.h"
+
+bool SceneInterestGrid::_get_cell(const Vector3 &p_point, Vector3i &r_cell) const {
+	const Vector3 cell = (p_point / cell_size).floor();
+	if (!cell.is_finite() || Math::abs(cell.x) > MAX_CELL_COORD || Math::abs(cell.y) > MAX_CELL_COORD || Math::abs(cell.z) > MAX_CELL_COORD) {
+		return false;
+	}
+	r_cell = Vector3i(cell);
+	return true;
+}
+
+void SceneInterestGrid::_place(Entry &r_entry) const {
+	const real_t reach = Math::ceil(r_entry.radius / cell_size);
+	if (reach > MAX_CELL_REACH || !_get_cell(r_entry.position, r_entry.cell)) {
+		r_entry.reach = 0;
+		r_entry.cell = Vector3i();
+	} else {
+		r_entry.reach = MAX(1, int(reach));
+	}
+}
+
+void SceneInterestGrid::_insert(const ObjectID &p_id, const Entry &p_entry) {
+	if (p_entry.reach == 0) {
+		large_entries.push_back(p_id);
+		return;
+	}
+	reach_counts[p_entry.reach]++;
+	if (p_entry.cell.z != 0) {
+		non_flat_count++;
+	}
+	cells[p_entry.cell].push_back(p_id);
+}
+
+void SceneInterestGrid::_remove(const ObjectID &p_id, const Entry &p_entry) {
+	if (p_entry.reach == 0) {
+		large_entries.erase_unordered(p_id);
+		return;
+	}
+	reach_counts[p_entry.reach]--;
+	if (p_entry.cell.z != 0) {
+		non_flat_count--;
+	}
+	HashMap<Vector3i, LocalVector<ObjectID>>::Iterator E = cells.find(p_entry.cell);
+	ERR_FAIL_COND(!E); // Bug.
+	E->value.erase_unordered(p_id);
+	if (E->value.is_empty()) {
+		cells.remove(E);
+	}
+}
+
+void SceneInterestGrid::set_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(!Math::is_finite(p_size) || p_size <= 0, "Interest cell size must be greater than 0.");
+	if (cell_size == p_size) {
+		return;
+	}
+	cell_size = p_size;
+	cells.clear();
+	large_entries.clear();
+	for (uint32_t &count : reach_counts) {
+		count = 0;
+	}
+	non_flat_count = 0;
+	for (KeyValue<ObjectID, Entry> &E : entries) {
+		_place(E.value);
+		_insert(E.key, E.value);
+	}
+}
+
+void SceneInterestGrid::update(const ObjectID &p_id, const Vector3 &p_position, real_t p_radius) {
+	if (!p_position.is_finite() || !Math::is_finite(p_radius) || p_radius <= 0) {
+		remove(p_id);
+		ERR_FAIL_MSG("Interest position and radius must be finite, and the radius must be greater than 0.");
+	}
+
+	Entry placed;
+	placed.position = p_position;
+	placed.radius = p_radius;
+	_place(placed);
+
+	Entry *entry = entries.getptr(p_id);
+	if (!entry) {
+		entries.insert(p_id, placed);
+		_insert(p_id, placed);
+		return;
+	}
+	// Objects are only re-bucketed when they change cell, or when their reach changes.
+	if (placed.reach != entry->reach || placed.cell != entry->cell) {
+		_remove(p_id, *entry);
+		_insert(p_id, placed);
+	}
+	*entry = placed;
+}
+
+void SceneInterestGrid::remove(const ObjectID &p_id) {
+	HashMap<ObjectID, Entry>::Iterator E = entries.find(p_id);
+	if (!E) {
+		return;
+	}
+	_remove(p_id, E->value);
+	entries.remove(E);
+}
+
+void SceneInterestGrid::clear() {
+	entries.clear();
+	cells.clear();
+	large_entries.clear();
+	for (uint32_t &count : reach_counts) {
+		count = 0;
+	}
+	non_flat_count = 0;
+}
+
+bool SceneInterestGrid::is_relevant(const ObjectID &p_id, const Vector3 &p_point) const {
+	const Entry *entry = entries.getptr(p_id);
+	return entry && entry->position.distance_squared_to(p_point) <= entry->radius * entry->radius;
+}
+
+void SceneInterestGrid::query(const Vector3 &p_point, HashSet<ObjectID> &r_relevant) const {
+	if (!p_point.is_finite()) {
+		return;
+	}
+
+	for (const ObjectID &id : large_entries) {
+		const Entry &entry = entries[id];
+		if (entry.position.distance_squared_to(p_point) <= entry.radius * entry.radius) {
+			r_relevant.insert(id);
+		}
+	}
+
+	int reach = MAX_CELL_REACH;
+	while (reach > 0 && reach_counts[reach] == 0) {
+		reach--;
+	}
+	Vector3i center;
+	if (reach == 0 || !_get_cell(p_point, center)) {
+		return; // Nothing is stored in cells, or the point is too far away from all of them.
+	}
+
+	const Vector3i from = center - Vector3i(reach, reach, reach);
+	const Vector3i to = center + Vector3i(reach, reach, reach);
+	int z_from = from.z;
+	int z_to = to.z;
+	if (non_flat_count == 0) {
+		// Everything is in the z = 0 layer (e.g. 2D scenes), so other layers don't need to be looked up.
+		if (z_from > 0 || z_to < 0) {
+			return;
+		}
+		z_from = 0;
+		z_to = 0;
+	}
+	for (int x = from.x; x <= to.x; x++) {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int z = z_from; z <= z_to; z++) {
+				const LocalVector<ObjectID> *candidates = cells.getptr(Vector3i(x, y, z));
+				if (!candidates) {
+					continue;
+				}
+				for (const ObjectID &id : *candidates) {
+					const Entry &entry = entries[id];
+					if (entry.position.distance_squared_to(p_point) <= entry.radius * entry.radius) {
+						r_relevant.insert(id);
+					}
+				}
+			}
+		}
+	}
+}
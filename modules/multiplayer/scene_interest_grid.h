@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  scene_interest_grid.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/object/object_id.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// Uniform spatial hash used for replication interest management.
+// Each object is stored in the single cell containing its position. Queries
+// look up the neighboring cells out to the largest registered radius, so
+// objects whose radius spans more than a few cells are kept in a separate
+// list instead, which every query checks.
+class SceneInterestGrid {
+	// Largest radius, in cells, of the objects stored in cells.
+	static constexpr int MAX_CELL_REACH = 2;
+	// Cell coordinates are kept well within the int range, so neighbor lookups can't overflow.
+	static constexpr real_t MAX_CELL_COORD = 1 << 30;
+
+	struct Entry {
+		Vector3 position;
+		real_t radius = 0;
+		Vector3i cell;
+		int reach = 0; // Radius in cells, rounded up. 0 if in the list of large entries.
+	};
+
+	real_t cell_size = 64;
+	HashMap<ObjectID, Entry> entries;
+	HashMap<Vector3i, LocalVector<ObjectID>> cells;
+	LocalVector<ObjectID> large_entries;
+	uint32_t reach_counts[MAX_CELL_REACH + 1] = {};
+	uint32_t non_flat_count = 0; // Entries stored outside of the z = 0 layer of cells. 2D scenes have none.
+
+	bool _get_cell(const Vector3 &p_point, Vector3i &r_cell) const;
+	void _place(Entry &r_entry) const;
+	void _insert(const ObjectID &p_id, const Entry &p_entry);
+	void _remove(const ObjectID &p_id, const Entry &p_entry);
+
+public:
+	void set_cell_size(real_t p_size);
+	real_t get_cell_size() const { return cell_size; }
+
+	void update(const ObjectID &p_id, const Vector3 &p_position, real_t p_radius);
+	void remove(const ObjectID &p_id);
+	bool has(const ObjectID &p_id) const { return entries.has(p_id); }
+	uint32_t size() const { return entries.size(); }
+	void clear();
+
+	bool is_relevant(const ObjectID &p_id, const Vector3 &p_point) const;
+	void query(const Vector3 &p_point, HashSet<ObjectID> &r_relevant) const;
+};
@@ -45,6 +45,15 @@ _FORCE_INLINE_ void SceneMultiplayer::_profile_bandwidth(const String &p_what, i
 		EngineDebugger::profiler_add_frame_data("multiplayer:bandwidth", values);
 	}
 }
+
+_FORCE_INLINE_ void SceneMultiplayer::_profile_batching(int p_messages) {
+	if (EngineDebugger::is_profiling("multiplayer:batching")) {
+		Array values = {
+			p_messages
+		};
+		EngineDebugger::profiler_add_frame_data("multiplayer:batching", values);
+	}
+}
 #endif
 
 void SceneMultiplayer::_update_status() {
@@ -68,6 +77,9 @@ Error SceneMultiplayer::poll() {
 		return OK;
 	}
 
+	// Hand over the messages queued since the last poll before the peer services the connection.
+	_flush_batches();
+
 	multiplayer_peer->poll();
 
 	_update_status();
@@ -161,6 +173,7 @@ Error SceneMultiplayer::poll() {
 	}
 
 	replicator->on_network_process();
+	_flush_batches();
 	return OK;
 }
 
@@ -169,6 +182,7 @@ void SceneMultiplayer::clear() {
 	pending_peers.clear();
 	connected_peers.clear();
 	packet_cache.clear();
+	packet_batches.clear();
 	replicator->on_reset();
 	cache->clear();
 	relay_buffer->clear();
@@ -192,6 +206,9 @@ void SceneMultiplayer::set_multiplayer_peer(const Ref<MultiplayerPeer> &p_peer)
 			"Supplied MultiplayerPeer must be connecting or connected.");
 
 	if (multiplayer_peer.is_valid()) {
+		if (last_connection_status == MultiplayerPeer::CONNECTION_CONNECTED) {
+			_flush_batches();
+		}
 		multiplayer_peer->disconnect("peer_connected", callable_mp(this, &SceneMultiplayer::_add_peer));
 		multiplayer_peer->disconnect("peer_disconnected", callable_mp(this, &SceneMultiplayer::_del_peer));
 		clear();
@@ -255,6 +272,90 @@ _FORCE_INLINE_ Error SceneMultiplayer::_send(const uint8_t *p_packet, int p_pack
 }
 #endif
 
+Error SceneMultiplayer::_send_to(int p_peer, const uint8_t *p_packet, int p_packet_len) {
+	if (!packet_batching) {
+		multiplayer_peer->set_target_peer(p_peer);
+#ifdef DEBUG_ENABLED
+		_profile_batching(1);
+#endif
+		return _send(p_packet, p_packet_len);
+	}
+
+	const MultiplayerPeer::TransferMode mode = multiplayer_peer->get_transfer_mode();
+	const int channel = multiplayer_peer->get_transfer_channel();
+	const uint64_t key = (uint64_t(uint32_t(p_peer)) << 32) | (uint64_t(mode) << 16) | uint64_t(channel & 0xFFFF);
+	HashMap<uint64_t, PacketBatch>::Iterator E = packet_batches.find(key);
+	if (!E) {
+		PacketBatch batch;
+		batch.peer = p_peer;
+		batch.mode = mode;
+		batch.channel = channel;
+		E = packet_batches.insert(key, batch);
+	}
+	PacketBatch &batch = E->value;
+
+	const int entry_size = BATCH_ENTRY_HEADER_SIZE + p_packet_len;
+	if (batch.messages && int(batch.data.size()) + entry_size > max_batch_size) {
+		_flush_batch(batch);
+	}
+	if (SYS_CMD_SIZE + entry_size > max_batch_size) {
+		// Too big to share a packet. Pending messages were flushed above, so ordering is preserved.
+		multiplayer_peer->set_target_peer(p_peer);
+#ifdef DEBUG_ENABLED
+		_profile_batching(1);
+#endif
+		return _send(p_packet, p_packet_len);
+	}
+
+	if (batch.data.is_empty()) {
+		batch.data.resize(SYS_CMD_SIZE);
+		batch.data[0] = NETWORK_COMMAND_SYS;
+		batch.data[1] = SYS_COMMAND_BATCH;
+	}
+	const uint32_t ofs = batch.data.size();
+	batch.data.resize(ofs + entry_size);
+	encode_uint16(p_packet_len, &batch.data[ofs]);
+	memcpy(&batch.data[ofs + BATCH_ENTRY_HEADER_SIZE], p_packet, p_packet_len);
+	batch.messages++;
+	return OK;
+}
+
+void SceneMultiplayer::_flush_batch(PacketBatch &p_batch) {
+	if (!p_batch.messages) {
+		return;
+	}
+	multiplayer_peer->set_target_peer(p_batch.peer);
+	multiplayer_peer->set_transfer_mode(p_batch.mode);
+	multiplayer_peer->set_transfer_channel(p_batch.channel);
+	if (p_batch.messages == 1) {
+		// A lone message does not need the batch framing.
+		const int ofs = SYS_CMD_SIZE + BATCH_ENTRY_HEADER_SIZE;
+		_send(&p_batch.data[ofs], p_batch.data.size() - ofs);
+	} else {
+		encode_uint32(p_batch.messages, &p_batch.data[2]);
+		_send(p_batch.data.ptr(), p_batch.data.size());
+	}
+#ifdef DEBUG_ENABLED
+	_profile_batching(p_batch.messages);
+#endif
+	p_batch.messages = 0;
+	p_batch.data.clear();
+}
+
+void SceneMultiplayer::_flush_batches() {
+	if (packet_batches.is_empty() || multiplayer_peer.is_null()) {
+		return;
+	}
+	// Callers may have configured the peer for their next send, restore it after flushing.
+	const MultiplayerPeer::TransferMode mode = multiplayer_peer->get_transfer_mode();
+	const int channel = multiplayer_peer->get_transfer_channel();
+	for (KeyValue<uint64_t, PacketBatch> &E : packet_batches) {
+		_flush_batch(E.value);
+	}
+	multiplayer_peer->set_transfer_mode(mode);
+	multiplayer_peer->set_transfer_channel(channel);
+}
+
 Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_packet_len) {
 	if (server_relay && get_unique_id() != 1 && p_to != 1 && multiplayer_peer->is_server_relay_supported()) {
 		// Send relay packet.
@@ -263,21 +364,18 @@ Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_pa
 		relay_buffer->put_u8(SYS_COMMAND_RELAY);
 		relay_buffer->put_32(p_to); // Set the destination.
 		relay_buffer->put_data(p_packet, p_packet_len);
-		multiplayer_peer->set_target_peer(1);
 		const Vector<uint8_t> data = relay_buffer->get_data_array();
-		return _send(data.ptr(), relay_buffer->get_position());
+		return _send_to(1, data.ptr(), relay_buffer->get_position());
 	}
 	if (p_to > 0) {
 		ERR_FAIL_COND_V(!connected_peers.has(p_to), ERR_BUG);
-		multiplayer_peer->set_target_peer(p_to);
-		return _send(p_packet, p_packet_len);
+		return _send_to(p_to, p_packet, p_packet_len);
 	} else {
 		for (const int &pid : connected_peers) {
 			if (p_to && pid == -p_to) {
 				continue;
 			}
-			multiplayer_peer->set_target_peer(pid);
-			_send(p_packet, p_packet_len);
+			_send_to(pid, p_packet, p_packet_len);
 		}
 		return OK;
 	}
@@ -318,8 +416,7 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 				multiplayer_peer->set_transfer_channel(p_channel);
 				if (peer > 0) {
 					// Single destination.
-					multiplayer_peer->set_target_peer(peer);
-					_send(data.ptr(), relay_buffer->get_position());
+					_send_to(peer, data.ptr(), relay_buffer->get_position());
 				} else {
 					// Multiple destinations.
 					for (const int &P : connected_peers) {
@@ -327,8 +424,7 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 						if (P == p_from || P == -peer) {
 							continue;
 						}
-						multiplayer_peer->set_target_peer(P);
-						_send(data.ptr(), relay_buffer->get_position());
+						_send_to(P, data.ptr(), relay_buffer->get_position());
 					}
 					if (peer != -1) {
 						// The server is one of the targets, process the packet with sender as source.
@@ -346,12 +442,44 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 				remote_sender_id = 0;
 			}
 		} break;
+		case SYS_COMMAND_BATCH: {
+			_process_batch(p_from, p_packet, p_packet_len, p_mode, p_channel);
+		} break;
 		default: {
 			ERR_FAIL();
 		}
 	}
 }
 
+void SceneMultiplayer::_process_batch(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel) {
+	// The peer field of a batch holds the number of messages it contains.
+	const uint32_t count = decode_uint32(&p_packet[2]);
+	int ofs = SYS_CMD_SIZE;
+	for (uint32_t i = 0; i < count; i++) {
+		ERR_FAIL_COND_MSG(ofs + BATCH_ENTRY_HEADER_SIZE > p_packet_len, "Invalid batch received. Size too small.");
+		const int len = decode_uint16(&p_packet[ofs]);
+		ofs += BATCH_ENTRY_HEADER_SIZE;
+		ERR_FAIL_COND_MSG(len < 1 || ofs + len > p_packet_len, "Invalid batch received. Message size is out of bounds.");
+		const uint8_t *packet = &p_packet[ofs];
+		ofs += len;
+
+		if ((packet[0] & CMD_MASK) == NETWORK_COMMAND_SYS) {
+			ERR_FAIL_COND_MSG(len > 1 && (packet[1] == SYS_COMMAND_AUTH || packet[1] == SYS_COMMAND_BATCH), "Invalid batch received. Authentication and batch messages can't be batched.");
+			_process_sys(p_from, packet, len, p_mode, p_channel);
+		} else {
+			remote_sender_id = p_from;
+			_process_packet(p_from, packet, len);
+			remote_sender_id = 0;
+		}
+
+		_update_status();
+		if (last_connection_status != MultiplayerPeer::CONNECTION_CONNECTED || !connected_peers.has(p_from)) {
+			return; // Processing the message resulted in a disconnection.
+		}
+	}
+	ERR_FAIL_COND_MSG(ofs != p_packet_len, "Invalid batch received. Trailing data after the last message.");
+}
+
 void SceneMultiplayer::_add_peer(int p_id) {
 	if (auth_callback.is_valid()) {
 		pending_peers[p_id] = PendingPeer();
@@ -374,12 +502,10 @@ void SceneMultiplayer::_admit_peer(int p_id) {
 		for (const int &P : connected_peers) {
 			// Send new peer to already connected.
 			encode_uint32(p_id, &buf[2]);
-			multiplayer_peer->set_target_peer(P);
-			_send(buf, sizeof(buf));
+			_send_to(P, buf, sizeof(buf));
 			// Send already connected to new peer.
 			encode_uint32(P, &buf[2]);
-			multiplayer_peer->set_target_peer(p_id);
-			_send(buf, sizeof(buf));
+			_send_to(p_id, buf, sizeof(buf));
 		}
 	}
 
@@ -413,8 +539,20 @@ void SceneMultiplayer::_del_peer(int p_id) {
 			if (P == p_id) {
 				continue;
 			}
-			multiplayer_peer->set_target_peer(P);
-			_send(buf, sizeof(buf));
+			_send_to(P, buf, sizeof(buf));
+		}
+	}
+
+	if (packet_batches.size()) {
+		// Messages still queued for the disconnected peer can't be delivered anymore.
+		LocalVector<uint64_t> to_erase;
+		for (const KeyValue<uint64_t, PacketBatch> &E : packet_batches) {
+			if (E.value.peer == p_id) {
+				to_erase.push_back(E.key);
+			}
+		}
+		for (const uint64_t &key : to_erase) {
+			packet_batches.erase(key);
 		}
 	}
 
@@ -633,6 +771,46 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_packet_batching_enabled(bool p_enabled) {
+	if (packet_batching && !p_enabled) {
+		_flush_batches();
+	}
+	packet_batching = p_enabled;
+}
+
+bool SceneMultiplayer::is_packet_batching_enabled() const {
+	return packet_batching;
+}
+
+void SceneMultiplayer::set_max_batch_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < SYS_CMD_SIZE + BATCH_ENTRY_HEADER_SIZE + 1 || p_size > UINT16_MAX, "The maximum batch size must be between 9 and 65535 bytes.");
+	max_batch_size = p_size;
+}
+
+int SceneMultiplayer::get_max_batch_size() const {
+	return max_batch_size;
+}
+
+void SceneMultiplayer::set_interest_cell_size(real_t p_size) {
+	replicator->set_interest_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_interest_cell_size() const {
+	return replicator->get_interest_cell_size();
+}
+
+void SceneMultiplayer::set_peer_interest_position(int p_peer, const Vector3 &p_position) {
+	replicator->set_peer_interest_position(p_peer, p_position);
+}
+
+Vector3 SceneMultiplayer::get_peer_interest_position(int p_peer) const {
+	return replicator->get_peer_interest_position(p_peer);
+}
+
+void SceneMultiplayer::clear_peer_interest_position(int p_peer) {
+	replicator->clear_peer_interest_position(p_peer);
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -661,6 +839,15 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("set_packet_batching_enabled", "enabled"), &SceneMultiplayer::set_packet_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_packet_batching_enabled"), &SceneMultiplayer::is_packet_batching_enabled);
+	ClassDB::bind_method(D_METHOD("get_max_batch_size"), &SceneMultiplayer::get_max_batch_size);
+	ClassDB::bind_method(D_METHOD("set_max_batch_size", "size"), &SceneMultiplayer::set_max_batch_size);
+	ClassDB::bind_method(D_METHOD("get_interest_cell_size"), &SceneMultiplayer::get_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_interest_cell_size", "size"), &SceneMultiplayer::set_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_peer_interest_position", "peer", "position"), &SceneMultiplayer::set_peer_interest_position);
+	ClassDB::bind_method(D_METHOD("get_peer_interest_position", "peer"), &SceneMultiplayer::get_peer_interest_position);
+	ClassDB::bind_method(D_METHOD("clear_peer_interest_position", "peer"), &SceneMultiplayer::clear_peer_interest_position);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -670,6 +857,9 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "packet_batching"), "set_packet_batching_enabled", "is_packet_batching_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_batch_size", PROPERTY_HINT_RANGE, "9,65535,1,suffix:B"), "set_max_batch_size", "get_max_batch_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_cell_size", PROPERTY_HINT_RANGE, "1,1000,0.01,or_greater"), "set_interest_cell_size", "get_interest_cell_size");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
@@ -81,10 +81,12 @@ public:
 		SYS_COMMAND_ADD_PEER,
 		SYS_COMMAND_DEL_PEER,
 		SYS_COMMAND_RELAY,
+		SYS_COMMAND_BATCH,
 	};
 
 	enum {
 		SYS_CMD_SIZE = 6, // Command + sys command + peer_id (+ optional payload).
+		BATCH_ENTRY_HEADER_SIZE = 2, // Size of each message in a batch (u16).
 	};
 
 	// For each command, the 4 MSB can contain custom flags, as defined by subsystems.
@@ -107,6 +109,14 @@ private:
 		uint64_t time = 0;
 	};
 
+	struct PacketBatch {
+		int peer = 0;
+		MultiplayerPeer::TransferMode mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		int channel = 0;
+		uint32_t messages = 0;
+		LocalVector<uint8_t> data;
+	};
+
 	Ref<MultiplayerPeer> multiplayer_peer;
 	MultiplayerPeer::ConnectionStatus last_connection_status = MultiplayerPeer::CONNECTION_DISCONNECTED;
 	HashMap<int, PendingPeer> pending_peers; // true if locally finalized.
@@ -122,6 +132,9 @@ private:
 	bool allow_object_decoding = false;
 	bool server_relay = true;
 	Ref<StreamPeerBuffer> relay_buffer;
+	bool packet_batching = false;
+	int max_batch_size = 1200;
+	HashMap<uint64_t, PacketBatch> packet_batches; // Keyed by peer, transfer mode and channel.
 
 	Ref<SceneCacheInterface> cache;
 	Ref<SceneReplicationInterface> replicator;
@@ -129,6 +142,7 @@ private:
 
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_bandwidth(const String &p_what, int p_value);
+	_FORCE_INLINE_ void _profile_batching(int p_messages);
 	_FORCE_INLINE_ Error _send(const uint8_t *p_packet, int p_packet_len); // Also profiles.
 #else
 	_FORCE_INLINE_ Error _send(const uint8_t *p_packet, int p_packet_len) {
@@ -142,6 +156,11 @@ protected:
 	void _process_packet(int p_from, const uint8_t *p_packet, int p_packet_len);
 	void _process_raw(int p_from, const uint8_t *p_packet, int p_packet_len);
 	void _process_sys(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel);
+	void _process_batch(int p_from, const uint8_t *p_packet, int p_packet_len, MultiplayerPeer::TransferMode p_mode, int p_channel);
+
+	Error _send_to(int p_peer, const uint8_t *p_packet, int p_packet_len); // Batches the packet when enabled.
+	void _flush_batch(PacketBatch &p_batch);
+	void _flush_batches();
 
 	void _add_peer(int p_id);
 	void _admit_peer(int p_id);
@@ -200,6 +219,19 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_packet_batching_enabled(bool p_enabled);
+	bool is_packet_batching_enabled() const;
+
+	void set_max_batch_size(int p_size);
+	int get_max_batch_size() const;
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_peer_interest_position(int p_peer, const Vector3 &p_position);
+	Vector3 get_peer_interest_position(int p_peer) const;
+	void clear_peer_interest_position(int p_peer);
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
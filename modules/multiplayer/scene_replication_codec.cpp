@@ -0,0 +1,369 @@
+/**************************************************************************/
+/*  scene_replication_codec.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_codec.h"
+
+#include "scene/main/multiplayer_api.h"
+
+void SceneReplicationCodec::BitWriter::write(uint32_t p_value, int p_bits) {
+	if (p_bits == 0) {
+		return;
+	}
+	const uint64_t mask = p_bits == 32 ? 0xFFFFFFFFULL : ((uint64_t(1) << p_bits) - 1);
+	cache |= (uint64_t(p_value) & mask) << cache_bits;
+	cache_bits += p_bits;
+	while (cache_bits >= 8) {
+		buffer.push_back(uint8_t(cache));
+		cache >>= 8;
+		cache_bits -= 8;
+	}
+}
+
+void SceneReplicationCodec::BitWriter::flush() {
+	if (cache_bits > 0) {
+		buffer.push_back(uint8_t(cache));
+	}
+	cache = 0;
+	cache_bits = 0;
+}
+
+uint32_t SceneReplicationCodec::BitReader::read(int p_bits) {
+	if (p_bits == 0) {
+		return 0;
+	}
+	while (cache_bits < p_bits) {
+		if (pos >= len) {
+			overflow = true;
+			return 0;
+		}
+		cache |= uint64_t(src[pos++]) << cache_bits;
+		cache_bits += 8;
+	}
+	const uint64_t mask = p_bits == 32 ? 0xFFFFFFFFULL : ((uint64_t(1) << p_bits) - 1);
+	const uint32_t value = uint32_t(cache & mask);
+	cache >>= p_bits;
+	cache_bits -= p_bits;
+	return value;
+}
+
+SceneReplicationCodec::Kind SceneReplicationCodec::_get_kind(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::FLOAT:
+			return KIND_FLOAT;
+		case Variant::VECTOR2:
+			return KIND_VECTOR2;
+		case Variant::VECTOR3:
+			return KIND_VECTOR3;
+		case Variant::VECTOR4:
+			return KIND_VECTOR4;
+		case Variant::COLOR:
+			return KIND_COLOR;
+		case Variant::QUATERNION:
+			return KIND_QUATERNION;
+		default:
+			return KIND_NONE;
+	}
+}
+
+static _FORCE_INLINE_ uint32_t _quantize_real(double p_value, double p_min, double p_max, int p_bits) {
+	const double steps = double((uint64_t(1) << p_bits) - 1);
+	const double t = (p_value - p_min) / (p_max - p_min);
+	if (!(t > 0)) {
+		return 0; // Also handles NaN.
+	}
+	return uint32_t(Math::round(MIN(t, 1.0) * steps));
+}
+
+static _FORCE_INLINE_ double _dequantize_real(uint32_t p_value, double p_min, double p_max, int p_bits) {
+	const double steps = double((uint64_t(1) << p_bits) - 1);
+	return p_min + (double(p_value) / steps) * (p_max - p_min);
+}
+
+int SceneReplicationCodec::_quantize(const Variant &p_value, Kind p_kind, const SceneReplicationConfig::Quantization &p_quantization, uint32_t *r_components) {
+	const int bits = p_quantization.bits;
+	const double min = p_quantization.range_min;
+	const double max = p_quantization.range_max;
+	switch (p_kind) {
+		case KIND_FLOAT: {
+			r_components[0] = _quantize_real(p_value.operator double(), min, max, bits);
+			return 1;
+		}
+		case KIND_VECTOR2: {
+			const Vector2 v = p_value;
+			for (int i = 0; i < 2; i++) {
+				r_components[i] = _quantize_real(v[i], min, max, bits);
+			}
+			return 2;
+		}
+		case KIND_VECTOR3: {
+			const Vector3 v = p_value;
+			for (int i = 0; i < 3; i++) {
+				r_components[i] = _quantize_real(v[i], min, max, bits);
+			}
+			return 3;
+		}
+		case KIND_VECTOR4: {
+			const Vector4 v = p_value;
+			for (int i = 0; i < 4; i++) {
+				r_components[i] = _quantize_real(v[i], min, max, bits);
+			}
+			return 4;
+		}
+		case KIND_COLOR: {
+			const Color v = p_value;
+			for (int i = 0; i < 4; i++) {
+				r_components[i] = _quantize_real(v[i], min, max, bits);
+			}
+			return 4;
+		}
+		case KIND_QUATERNION: {
+			// Smallest three: the largest component is dropped and rebuilt from the
+			// others, which all fit in [-sqrt(0.5), sqrt(0.5)]. The range is ignored.
+			Quaternion q = p_value;
+			q = q.length_squared() > 0 ? q.normalized() : Quaternion();
+			int largest = 0;
+			for (int i = 1; i < 4; i++) {
+				if (Math::abs(q[i]) > Math::abs(q[largest])) {
+					largest = i;
+				}
+			}
+			const real_t sign = q[largest] < 0 ? -1 : 1;
+			int c = 0;
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					r_components[c++] = _quantize_real(q[i] * sign, -Math::SQRT12, Math::SQRT12, bits);
+				}
+			}
+			r_components[3] = largest;
+			return 3;
+		}
+		default: {
+			ERR_FAIL_V(0);
+		}
+	}
+}
+
+Variant SceneReplicationCodec::_dequantize(Kind p_kind, const uint32_t *p_components, const SceneReplicationConfig::Quantization &p_quantization) {
+	const int bits = p_quantization.bits;
+	const double min = p_quantization.range_min;
+	const double max = p_quantization.range_max;
+	switch (p_kind) {
+		case KIND_FLOAT: {
+			return _dequantize_real(p_components[0], min, max, bits);
+		}
+		case KIND_VECTOR2: {
+			Vector2 v;
+			for (int i = 0; i < 2; i++) {
+				v[i] = _dequantize_real(p_components[i], min, max, bits);
+			}
+			return v;
+		}
+		case KIND_VECTOR3: {
+			Vector3 v;
+			for (int i = 0; i < 3; i++) {
+				v[i] = _dequantize_real(p_components[i], min, max, bits);
+			}
+			return v;
+		}
+		case KIND_VECTOR4: {
+			Vector4 v;
+			for (int i = 0; i < 4; i++) {
+				v[i] = _dequantize_real(p_components[i], min, max, bits);
+			}
+			return v;
+		}
+		case KIND_COLOR: {
+			Color v;
+			for (int i = 0; i < 4; i++) {
+				v[i] = _dequantize_real(p_components[i], min, max, bits);
+			}
+			return v;
+		}
+		case KIND_QUATERNION: {
+			const int largest = p_components[3];
+			Quaternion q;
+			real_t sum = 0;
+			int c = 0;
+			for (int i = 0; i < 4; i++) {
+				if (i != largest) {
+					q[i] = _dequantize_real(p_components[c++], -Math::SQRT12, Math::SQRT12, bits);
+					sum += q[i] * q[i];
+				}
+			}
+			q[largest] = Math::sqrt(MAX(0.0, 1.0 - sum));
+			return q.normalized();
+		}
+		default: {
+			ERR_FAIL_V(Variant());
+		}
+	}
+}
+
+Error SceneReplicationCodec::encode(const LocalVector<EncodeField> &p_fields, LocalVector<uint8_t> &r_buffer, bool p_allow_object_decoding) {
+	// Bit-packed section.
+	BitWriter writer(r_buffer);
+	for (const EncodeField &field : p_fields) {
+		if (!field.quantization || field.quantization->bits == 0) {
+			continue;
+		}
+		const int bits = field.quantization->bits;
+		const Kind kind = _get_kind(field.value->get_type());
+		writer.write(kind, KIND_BITS);
+		if (kind == KIND_NONE) {
+			continue;
+		}
+		uint32_t components[4] = {};
+		const int count = _quantize(*field.value, kind, *field.quantization, components);
+		if (kind == KIND_QUATERNION) {
+			writer.write(components[3], QUATERNION_INDEX_BITS);
+		}
+
+		// Difference from the baseline, zigzag encoded, when it needs fewer bits.
+		uint32_t deltas[4] = {};
+		int width = 0;
+		bool use_delta = false;
+		Baseline *baseline = field.baseline;
+		if (baseline && baseline->kind == kind && (kind != KIND_QUATERNION || baseline->components[3] == components[3])) {
+			for (int i = 0; i < count; i++) {
+				const int64_t diff = int64_t(components[i]) - int64_t(baseline->components[i]);
+				const uint64_t zigzag = diff >= 0 ? uint64_t(diff) << 1 : (uint64_t(-diff) << 1) - 1;
+				int w = 0;
+				while (w < 64 && (zigzag >> w)) {
+					w++;
+				}
+				width = MAX(width, w);
+				deltas[i] = uint32_t(zigzag);
+			}
+			use_delta = width < bits;
+		}
+		if (baseline) {
+			writer.write(use_delta, 1);
+		}
+		if (use_delta) {
+			writer.write(width, DELTA_WIDTH_BITS);
+			for (int i = 0; i < count; i++) {
+				writer.write(deltas[i], width);
+			}
+		} else {
+			for (int i = 0; i < count; i++) {
+				writer.write(components[i], bits);
+			}
+		}
+		if (baseline) {
+			baseline->kind = kind;
+			memcpy(baseline->components, components, sizeof(components));
+		}
+	}
+	writer.flush();
+
+	// Regular Variant section.
+	for (const EncodeField &field : p_fields) {
+		if (field.quantization && field.quantization->bits > 0 && _get_kind(field.value->get_type()) != KIND_NONE) {
+			continue;
+		}
+		int size = 0;
+		Error err = MultiplayerAPI::encode_and_compress_variant(*field.value, nullptr, size, p_allow_object_decoding);
+		ERR_FAIL_COND_V(err != OK, err);
+		const uint32_t ofs = r_buffer.size();
+		r_buffer.resize(ofs + size);
+		err = MultiplayerAPI::encode_and_compress_variant(*field.value, r_buffer.ptr() + ofs, size, p_allow_object_decoding);
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	return OK;
+}
+
+Error SceneReplicationCodec::decode(const LocalVector<DecodeField> &p_fields, const uint8_t *p_buffer, int p_len, int &r_len, bool p_allow_object_decoding) {
+	r_len = 0;
+	LocalVector<bool> raw;
+	raw.resize(p_fields.size());
+
+	// Bit-packed section.
+	BitReader reader(p_buffer, p_len);
+	for (uint32_t f = 0; f < p_fields.size(); f++) {
+		const DecodeField &field = p_fields[f];
+		raw[f] = !field.quantization || field.quantization->bits == 0;
+		if (raw[f]) {
+			continue;
+		}
+		const int bits = field.quantization->bits;
+		const uint32_t kind = reader.read(KIND_BITS);
+		ERR_FAIL_COND_V_MSG(kind >= KIND_MAX, ERR_INVALID_DATA, "Invalid quantized value received.");
+		if (kind == KIND_NONE) {
+			raw[f] = true;
+			continue;
+		}
+		uint32_t components[4] = {};
+		static const int component_counts[KIND_MAX] = { 0, 1, 2, 3, 4, 4, 3 };
+		const int count = component_counts[kind];
+		if (kind == KIND_QUATERNION) {
+			components[3] = reader.read(QUATERNION_INDEX_BITS);
+		}
+		Baseline *baseline = field.baseline;
+		const bool use_delta = baseline && reader.read(1);
+		if (use_delta) {
+			ERR_FAIL_COND_V_MSG(baseline->kind != kind || (kind == KIND_QUATERNION && baseline->components[3] != components[3]), ERR_INVALID_DATA, "Received a delta without a matching previous value.");
+			const int width = reader.read(DELTA_WIDTH_BITS);
+			ERR_FAIL_COND_V(width > 32, ERR_INVALID_DATA);
+			const int64_t max_value = (int64_t(1) << bits) - 1;
+			for (int i = 0; i < count; i++) {
+				const uint32_t zigzag = reader.read(width);
+				const int64_t diff = (zigzag & 1) ? -(int64_t(zigzag >> 1) + 1) : int64_t(zigzag >> 1);
+				const int64_t value = int64_t(baseline->components[i]) + diff;
+				ERR_FAIL_COND_V(value < 0 || value > max_value, ERR_INVALID_DATA);
+				components[i] = uint32_t(value);
+			}
+		} else {
+			for (int i = 0; i < count; i++) {
+				components[i] = reader.read(bits);
+			}
+		}
+		ERR_FAIL_COND_V_MSG(reader.has_overflow(), ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+		if (baseline) {
+			baseline->kind = kind;
+			memcpy(baseline->components, components, sizeof(components));
+		}
+		*field.value = _dequantize(Kind(kind), components, *field.quantization);
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_overflow(), ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+	r_len = reader.get_consumed();
+
+	// Regular Variant section.
+	for (uint32_t f = 0; f < p_fields.size(); f++) {
+		if (!raw[f]) {
+			continue;
+		}
+		ERR_FAIL_COND_V_MSG(r_len >= p_len, ERR_INVALID_DATA, "Invalid packet received. Size too small.");
+		int vlen = 0;
+		Error err = MultiplayerAPI::decode_and_decompress_variant(*p_fields[f].value, p_buffer + r_len, p_len - r_len, &vlen, p_allow_object_decoding);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid packet received. Unable to decode state variable.");
+		r_len += vlen;
+	}
+	return OK;
+}
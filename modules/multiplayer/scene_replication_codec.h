@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  scene_replication_codec.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene_replication_config.h"
+
+#include "core/templates/local_vector.h"
+#include "core/variant/variant.h"
+
+// Encodes synchronizer states that use quantized properties.
+// Quantized values are bit-packed first (each prefixed by a small type tag),
+// followed by every other value using the regular compressed Variant encoding.
+// When a baseline is given, quantized values are sent as the difference from
+// the previous value, which requires an ordered and reliable channel.
+class SceneReplicationCodec {
+public:
+	enum Kind {
+		KIND_NONE, // Not quantizable, sent as a regular Variant.
+		KIND_FLOAT,
+		KIND_VECTOR2,
+		KIND_VECTOR3,
+		KIND_VECTOR4,
+		KIND_COLOR,
+		KIND_QUATERNION, // Smallest three components.
+		KIND_MAX,
+	};
+
+	// The last quantized value exchanged with a peer.
+	struct Baseline {
+		uint8_t kind = KIND_NONE;
+		uint32_t components[4] = {};
+	};
+
+	struct EncodeField {
+		const Variant *value = nullptr;
+		const SceneReplicationConfig::Quantization *quantization = nullptr;
+		Baseline *baseline = nullptr;
+	};
+
+	struct DecodeField {
+		Variant *value = nullptr;
+		const SceneReplicationConfig::Quantization *quantization = nullptr;
+		Baseline *baseline = nullptr;
+	};
+
+private:
+	static constexpr int KIND_BITS = 3;
+	static constexpr int QUATERNION_INDEX_BITS = 2;
+	static constexpr int DELTA_WIDTH_BITS = 6;
+
+	class BitWriter {
+		LocalVector<uint8_t> &buffer;
+		uint64_t cache = 0;
+		int cache_bits = 0;
+
+	public:
+		void write(uint32_t p_value, int p_bits);
+		void flush();
+
+		BitWriter(LocalVector<uint8_t> &r_buffer) :
+				buffer(r_buffer) {}
+	};
+
+	class BitReader {
+		const uint8_t *src = nullptr;
+		int len = 0;
+		int pos = 0;
+		uint64_t cache = 0;
+		int cache_bits = 0;
+		bool overflow = false;
+
+	public:
+		uint32_t read(int p_bits);
+		bool has_overflow() const { return overflow; }
+		int get_consumed() const { return pos; }
+
+		BitReader(const uint8_t *p_src, int p_len) :
+				src(p_src), len(p_len) {}
+	};
+
+	static Kind _get_kind(Variant::Type p_type);
+	static int _quantize(const Variant &p_value, Kind p_kind, const SceneReplicationConfig::Quantization &p_quantization, uint32_t *r_components);
+	static Variant _dequantize(Kind p_kind, const uint32_t *p_components, const SceneReplicationConfig::Quantization &p_quantization);
+
+public:
+	static Error encode(const LocalVector<EncodeField> &p_fields, LocalVector<uint8_t> &r_buffer, bool p_allow_object_decoding = false);
+	static Error decode(const LocalVector<DecodeField> &p_fields, const uint8_t *p_buffer, int p_len, int &r_len, bool p_allow_object_decoding = false);
+};
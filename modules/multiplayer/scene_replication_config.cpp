@@ -46,6 +46,17 @@ bool SceneReplicationConfig::_set(const StringName &p_name, const Variant &p_val
 		}
 		ERR_FAIL_INDEX_V(idx, properties.size(), false);
 		const ReplicationProperty &prop = properties.get(idx);
+		if (what == "quantization_bits") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
+			const Quantization &quantization = prop.quantization;
+			property_set_quantization(prop.name, p_value, quantization.range_min, quantization.range_max);
+			return true;
+		} else if (what == "quantization_range") {
+			ERR_FAIL_COND_V(p_value.get_type() != Variant::VECTOR2, false);
+			const Vector2 range = p_value;
+			property_set_quantization(prop.name, prop.quantization.bits, range.x, range.y);
+			return true;
+		}
 		if (what == "replication_mode") {
 			ERR_FAIL_COND_V(p_value.get_type() != Variant::INT, false);
 			ReplicationMode mode = (ReplicationMode)p_value.operator int();
@@ -87,16 +98,29 @@ bool SceneReplicationConfig::_get(const StringName &p_name, Variant &r_ret) cons
 		} else if (what == "replication_mode") {
 			r_ret = prop.mode;
 			return true;
+		} else if (what == "quantization_bits") {
+			r_ret = prop.quantization.bits;
+			return true;
+		} else if (what == "quantization_range") {
+			r_ret = Vector2(prop.quantization.range_min, prop.quantization.range_max);
+			return true;
 		}
 	}
 	return false;
 }
 
 void SceneReplicationConfig::_get_property_list(List<PropertyInfo> *p_list) const {
-	for (int i = 0; i < properties.size(); i++) {
+	int i = 0;
+	for (const ReplicationProperty &prop : properties) {
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::STRING, "properties/" + itos(i) + "/spawn", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/replication_mode", PROPERTY_HINT_ENUM, "Never,Always,On Change", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		// Only stored when used, so existing configurations are saved unchanged.
+		if (prop.quantization.bits > 0) {
+			p_list->push_back(PropertyInfo(Variant::INT, "properties/" + itos(i) + "/quantization_bits", PROPERTY_HINT_RANGE, "0,32", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+			p_list->push_back(PropertyInfo(Variant::VECTOR2, "properties/" + itos(i) + "/quantization_range", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		}
+		i++;
 	}
 }
 
@@ -106,6 +130,9 @@ void SceneReplicationConfig::reset_state() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	sync_quantization.clear();
+	watch_quantization.clear();
+	quantized = false;
 }
 
 TypedArray<NodePath> SceneReplicationConfig::get_properties() const {
@@ -222,6 +249,30 @@ void SceneReplicationConfig::property_set_replication_mode(const NodePath &p_pat
 	dirty = true;
 }
 
+void SceneReplicationConfig::property_set_quantization(const NodePath &p_path, int p_bits, real_t p_range_min, real_t p_range_max) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND(!E);
+	ERR_FAIL_COND_MSG(p_bits < 0 || p_bits > 32, "Quantization bits must be between 0 and 32 (where 0 disables quantization).");
+	ERR_FAIL_COND_MSG(p_range_min >= p_range_max, "Quantization range minimum must be less than its maximum.");
+	Quantization &quantization = E->get().quantization;
+	quantization.bits = p_bits;
+	quantization.range_min = p_range_min;
+	quantization.range_max = p_range_max;
+	dirty = true;
+}
+
+int SceneReplicationConfig::property_get_quantization_bits(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, 0);
+	return E->get().quantization.bits;
+}
+
+Vector2 SceneReplicationConfig::property_get_quantization_range(const NodePath &p_path) {
+	List<ReplicationProperty>::Element *E = properties.find(p_path);
+	ERR_FAIL_COND_V(!E, Vector2());
+	return Vector2(E->get().quantization.range_min, E->get().quantization.range_max);
+}
+
 void SceneReplicationConfig::_update() {
 	if (!dirty) {
 		return;
@@ -230,6 +281,9 @@ void SceneReplicationConfig::_update() {
 	sync_props.clear();
 	spawn_props.clear();
 	watch_props.clear();
+	sync_quantization.clear();
+	watch_quantization.clear();
+	quantized = false;
 	for (const ReplicationProperty &prop : properties) {
 		if (prop.spawn) {
 			spawn_props.push_back(prop.name);
@@ -237,9 +291,13 @@ void SceneReplicationConfig::_update() {
 		switch (prop.mode) {
 			case REPLICATION_MODE_ALWAYS:
 				sync_props.push_back(prop.name);
+				sync_quantization.push_back(prop.quantization);
+				quantized = quantized || prop.quantization.bits > 0;
 				break;
 			case REPLICATION_MODE_ON_CHANGE:
 				watch_props.push_back(prop.name);
+				watch_quantization.push_back(prop.quantization);
+				quantized = quantized || prop.quantization.bits > 0;
 				break;
 			default:
 				break;
@@ -268,6 +326,27 @@ const List<NodePath> &SceneReplicationConfig::get_watch_properties() {
 	return watch_props;
 }
 
+const LocalVector<SceneReplicationConfig::Quantization> &SceneReplicationConfig::get_sync_quantization() {
+	if (dirty) {
+		_update();
+	}
+	return sync_quantization;
+}
+
+const LocalVector<SceneReplicationConfig::Quantization> &SceneReplicationConfig::get_watch_quantization() {
+	if (dirty) {
+		_update();
+	}
+	return watch_quantization;
+}
+
+bool SceneReplicationConfig::has_quantization() {
+	if (dirty) {
+		_update();
+	}
+	return quantized;
+}
+
 void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_properties"), &SceneReplicationConfig::get_properties);
 	ClassDB::bind_method(D_METHOD("add_property", "path", "index"), &SceneReplicationConfig::add_property, DEFVAL(-1));
@@ -278,6 +357,9 @@ void SceneReplicationConfig::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("property_set_spawn", "path", "enabled"), &SceneReplicationConfig::property_set_spawn);
 	ClassDB::bind_method(D_METHOD("property_get_replication_mode", "path"), &SceneReplicationConfig::property_get_replication_mode);
 	ClassDB::bind_method(D_METHOD("property_set_replication_mode", "path", "mode"), &SceneReplicationConfig::property_set_replication_mode);
+	ClassDB::bind_method(D_METHOD("property_set_quantization", "path", "bits", "range_min", "range_max"), &SceneReplicationConfig::property_set_quantization, DEFVAL(-1.0), DEFVAL(1.0));
+	ClassDB::bind_method(D_METHOD("property_get_quantization_bits", "path"), &SceneReplicationConfig::property_get_quantization_bits);
+	ClassDB::bind_method(D_METHOD("property_get_quantization_range", "path"), &SceneReplicationConfig::property_get_quantization_range);
 
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_NEVER);
 	BIND_ENUM_CONSTANT(REPLICATION_MODE_ALWAYS);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 
 class SceneReplicationConfig : public Resource {
@@ -45,11 +46,18 @@ public:
 		REPLICATION_MODE_ON_CHANGE,
 	};
 
+	struct Quantization {
+		int bits = 0; // 0 means the property is sent as a regular Variant.
+		real_t range_min = -1;
+		real_t range_max = 1;
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		Quantization quantization;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -66,6 +74,9 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	LocalVector<Quantization> sync_quantization;
+	LocalVector<Quantization> watch_quantization;
+	bool quantized = false;
 	bool dirty = false;
 
 	void _update();
@@ -99,9 +110,16 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	void property_set_quantization(const NodePath &p_path, int p_bits, real_t p_range_min = -1, real_t p_range_max = 1);
+	int property_get_quantization_bits(const NodePath &p_path);
+	Vector2 property_get_quantization_range(const NodePath &p_path);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
+	const LocalVector<Quantization> &get_sync_quantization();
+	const LocalVector<Quantization> &get_watch_quantization();
+	bool has_quantization();
 
 	SceneReplicationConfig() {}
 };
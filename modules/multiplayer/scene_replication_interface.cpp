@@ -35,8 +35,13 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/node.h"
 
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif // _3D_DISABLED
+
 #define MAKE_ROOM(m_amount) \
 	if (packet_cache.size() < m_amount) \
 		packet_cache.resize(m_amount);
@@ -139,6 +144,10 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	if (!interest_syncs.is_empty()) {
+		_update_interest();
+	}
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
@@ -234,6 +243,7 @@ Error SceneReplicationInterface::on_replication_start(Object *p_obj, Variant p_c
 
 	// Update visibility.
 	sync->connect(SceneStringName(visibility_changed), callable_mp(this, &SceneReplicationInterface::_visibility_changed).bind(sync->get_instance_id()));
+	_update_interest_membership(sync);
 	_update_sync_visibility(0, sync);
 
 	if (pending_spawn == p_obj->get_instance_id() && sync->get_multiplayer_authority() == pending_spawn_remote) {
@@ -278,9 +288,13 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	interest_syncs.erase(sid);
+	interest_grid.remove(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
+		E.value.interest_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.delta_baselines.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -293,6 +307,7 @@ void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid)
 	ERR_FAIL_NULL(sync); // Bug.
 	Node *node = sync->get_root_node();
 	ERR_FAIL_NULL(node); // Bug.
+	_update_interest_membership(sync);
 	const ObjectID oid = node->get_instance_id();
 	if (spawned_nodes.has(oid) && p_peer != multiplayer->get_unique_id()) {
 		_update_spawn_visibility(p_peer, oid);
@@ -300,6 +315,102 @@ void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid)
 	_update_sync_visibility(p_peer, sync);
 }
 
+bool SceneReplicationInterface::_is_sync_visible_to(MultiplayerSynchronizer *p_sync, int p_peer) const {
+	const ObjectID sid = p_sync->get_instance_id();
+	if (!interest_syncs.has(sid)) {
+		return p_sync->is_visible_to(p_peer);
+	}
+	if (p_peer == 0) {
+		return false; // Interest is always resolved per peer.
+	}
+	// Interest is composed using AND with the synchronizer own visibility.
+	const PeerInfo *info = peers_info.getptr(p_peer);
+	return info && info->interest_nodes.has(sid) && p_sync->is_visible_to(p_peer);
+}
+
+bool SceneReplicationInterface::_get_interest_position(const Node *p_node, Vector3 &r_position) {
+	const Node2D *node_2d = Object::cast_to<Node2D>(p_node);
+	if (node_2d) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return r_position.is_finite();
+	}
+#ifndef _3D_DISABLED
+	const Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+	if (node_3d) {
+		r_position = node_3d->get_global_position();
+		return r_position.is_finite();
+	}
+#endif // _3D_DISABLED
+	return false;
+}
+
+void SceneReplicationInterface::_update_interest_membership(MultiplayerSynchronizer *p_sync) {
+	const ObjectID sid = p_sync->get_instance_id();
+	const real_t radius = p_sync->get_interest_radius();
+	Vector3 position;
+	if (radius > 0 && _has_authority(p_sync) && _get_interest_position(p_sync->get_root_node(), position)) {
+		interest_syncs.insert(sid);
+		interest_grid.update(sid, position, radius);
+	} else if (interest_syncs.has(sid)) {
+		interest_syncs.erase(sid);
+		interest_grid.remove(sid);
+		for (KeyValue<int, PeerInfo> &E : peers_info) {
+			E.value.interest_nodes.erase(sid);
+		}
+	}
+}
+
+void SceneReplicationInterface::_update_interest() {
+	// Move the tracked objects in the grid, they only change cells when crossing a cell boundary.
+	LocalVector<ObjectID> stale;
+	for (const ObjectID &sid : interest_syncs) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		Vector3 position;
+		if (sync->get_interest_radius() <= 0 || !_get_interest_position(sync->get_root_node(), position)) {
+			stale.push_back(sid);
+			continue;
+		}
+		interest_grid.update(sid, position, sync->get_interest_radius());
+	}
+	for (const ObjectID &sid : stale) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		ERR_CONTINUE(!sync);
+		_update_interest_membership(sync);
+		_update_sync_visibility(0, sync);
+	}
+
+	// Each peer only looks up the cell it is in, then the visibility of the objects
+	// that entered or left its area of interest is updated.
+	HashSet<ObjectID> relevant;
+	LocalVector<ObjectID> changed;
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		relevant.clear();
+		changed.clear();
+		if (E.value.has_interest_position) {
+			interest_grid.query(E.value.interest_position, relevant);
+		}
+		for (const ObjectID &sid : E.value.interest_nodes) {
+			if (!relevant.has(sid)) {
+				changed.push_back(sid);
+			}
+		}
+		for (const ObjectID &sid : relevant) {
+			if (!E.value.interest_nodes.has(sid)) {
+				changed.push_back(sid);
+			}
+		}
+		if (changed.is_empty()) {
+			continue;
+		}
+		SWAP(E.value.interest_nodes, relevant);
+		for (const ObjectID &sid : changed) {
+			_visibility_changed(E.key, sid);
+		}
+	}
+}
+
 bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer) const {
 	if (!tracked_nodes.has(p_oid)) {
 		return true; // Untracked nodes are always visible to RPCs.
@@ -331,7 +442,7 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 			// RPC visibility is composed using OR when multiple synchronizers are present.
 			// Note that we don't really care about authority here which may lead to unexpected
 			// results when using multiple synchronizers to control the same node.
-			if (sync->is_visible_to(p_peer)) {
+			if (_is_sync_visible_to(sync, p_peer)) {
 				return true;
 			}
 		}
@@ -346,11 +457,11 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 	}
 
 	const ObjectID &sid = p_sync->get_instance_id();
-	bool is_visible = p_sync->is_visible_to(p_peer);
+	bool is_visible = _is_sync_visible_to(p_sync, p_peer);
 	if (p_peer == 0) {
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
 			// Might be visible to this specific peer.
-			bool is_visible_to_peer = is_visible || p_sync->is_visible_to(E.key);
+			bool is_visible_to_peer = is_visible || _is_sync_visible_to(p_sync, E.key);
 			if (is_visible_to_peer == E.value.sync_nodes.has(sid)) {
 				continue;
 			}
@@ -359,6 +470,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			} else {
 				E.value.sync_nodes.erase(sid);
 				E.value.last_watch_usecs.erase(sid);
+				E.value.delta_baselines.erase(sid);
 			}
 		}
 		return OK;
@@ -372,6 +484,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
 			peers_info[p_peer].last_watch_usecs.erase(sid);
+			peers_info[p_peer].delta_baselines.erase(sid);
 		}
 		return OK;
 	}
@@ -395,7 +508,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 			continue;
 		}
 		// Spawn visibility is composed using OR when multiple synchronizers are present.
-		if (sync->is_visible_to(p_peer)) {
+		if (_is_sync_visible_to(sync, p_peer)) {
 			is_visible = true;
 			break;
 		}
@@ -463,6 +576,51 @@ Error SceneReplicationInterface::_send_raw(const uint8_t *p_buffer, int p_size,
 	return multiplayer->send_command(p_peer, p_buffer, p_size);
 }
 
+Error SceneReplicationInterface::_encode_quantized_state(const Vector<const Variant *> &p_values, const LocalVector<SceneReplicationConfig::Quantization> &p_quantization, uint64_t p_delta_indexes, LocalVector<SceneReplicationCodec::Baseline> *r_baselines) {
+	// With baselines, this is a delta and only the properties in p_delta_indexes are present.
+	LocalVector<SceneReplicationCodec::EncodeField> fields;
+	fields.resize(p_values.size());
+	uint32_t idx = 0;
+	for (uint32_t i = 0; i < fields.size(); i++) {
+		if (r_baselines) {
+			while (idx < 64 && !(p_delta_indexes & (1ULL << idx))) {
+				idx++;
+			}
+		} else {
+			idx = i;
+		}
+		ERR_FAIL_UNSIGNED_INDEX_V(idx, p_quantization.size(), ERR_BUG);
+		fields[i].value = p_values[i];
+		fields[i].quantization = &p_quantization[idx];
+		fields[i].baseline = r_baselines ? &(*r_baselines)[idx] : nullptr;
+		idx++;
+	}
+	codec_buffer.clear();
+	return SceneReplicationCodec::encode(fields, codec_buffer);
+}
+
+Error SceneReplicationInterface::_decode_quantized_state(Vector<Variant> &r_values, const LocalVector<SceneReplicationConfig::Quantization> &p_quantization, uint64_t p_delta_indexes, LocalVector<SceneReplicationCodec::Baseline> *r_baselines, const uint8_t *p_buffer, int p_len, int &r_len) {
+	LocalVector<SceneReplicationCodec::DecodeField> fields;
+	fields.resize(r_values.size());
+	Variant *values = r_values.ptrw();
+	uint32_t idx = 0;
+	for (uint32_t i = 0; i < fields.size(); i++) {
+		if (r_baselines) {
+			while (idx < 64 && !(p_delta_indexes & (1ULL << idx))) {
+				idx++;
+			}
+		} else {
+			idx = i;
+		}
+		ERR_FAIL_UNSIGNED_INDEX_V(idx, p_quantization.size(), ERR_INVALID_DATA);
+		fields[i].value = &values[i];
+		fields[i].quantization = &p_quantization[idx];
+		fields[i].baseline = r_baselines ? &(*r_baselines)[idx] : nullptr;
+		idx++;
+	}
+	return SceneReplicationCodec::decode(fields, p_buffer, p_len, r_len);
+}
+
 Error SceneReplicationInterface::_make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len) {
 	ERR_FAIL_COND_V(!multiplayer || !p_node || !p_spawner, ERR_BUG);
 
@@ -735,7 +893,23 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			i++;
 		}
 		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		Error err;
+		// Quantized values are encoded as the difference from the last ones sent to this peer.
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		const bool quantized = config->has_quantization();
+		LocalVector<SceneReplicationCodec::Baseline> baselines;
+		if (quantized) {
+			const LocalVector<SceneReplicationCodec::Baseline> *last_baselines = peers_info[p_peer].delta_baselines.getptr(oid);
+			if (last_baselines && last_baselines->size() == config->get_watch_quantization().size()) {
+				baselines = *last_baselines;
+			} else {
+				baselines.resize(config->get_watch_quantization().size());
+			}
+			err = _encode_quantized_state(varp, config->get_watch_quantization(), indexes, &baselines);
+			size = codec_buffer.size();
+		} else {
+			err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		}
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
 
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
@@ -749,13 +923,20 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint64(indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			if (quantized) {
+				memcpy(&ptr[ofs], codec_buffer.ptr(), size);
+			} else {
+				MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			}
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
 		_profile_node_data("delta_out", oid, size);
 #endif
 		peers_info[p_peer].last_watch_usecs[oid] = p_usec;
+		if (quantized) {
+			peers_info[p_peer].delta_baselines[oid] = baselines;
+		}
 	}
 	if (ofs > 1) {
 		// Got some left over to send.
@@ -784,7 +965,18 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		Error err;
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		if (config->has_quantization()) {
+			LocalVector<SceneReplicationCodec::Baseline> &baselines = sync->get_delta_baselines();
+			if (baselines.size() != config->get_watch_quantization().size()) {
+				baselines.clear();
+				baselines.resize(config->get_watch_quantization().size());
+			}
+			err = _decode_quantized_state(vars, config->get_watch_quantization(), indexes, &baselines, p_buffer + ofs, size, consumed);
+		} else {
+			err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		}
 		ERR_FAIL_COND_V(err != OK, err);
 		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
@@ -826,7 +1018,14 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		const List<NodePath> props(sync->get_replication_config_ptr()->get_sync_properties());
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		// Sync packets are unreliable, so quantized values are always sent in full.
+		const bool quantized = sync->get_replication_config_ptr()->has_quantization();
+		if (quantized) {
+			err = _encode_quantized_state(varp, sync->get_replication_config_ptr()->get_sync_quantization(), 0, nullptr);
+			size = codec_buffer.size();
+		} else {
+			err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		}
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
@@ -838,7 +1037,11 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			if (quantized) {
+				memcpy(&ptr[ofs], codec_buffer.ptr(), size);
+			} else {
+				MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			}
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -882,11 +1085,17 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 			ofs += size;
 			continue;
 		}
-		const List<NodePath> props(sync->get_replication_config_ptr()->get_sync_properties());
+		SceneReplicationConfig *config = sync->get_replication_config_ptr();
+		const List<NodePath> props(config->get_sync_properties());
 		Vector<Variant> vars;
 		vars.resize(props.size());
 		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		Error err;
+		if (config->has_quantization()) {
+			err = _decode_quantized_state(vars, config->get_sync_quantization(), 0, nullptr, &p_buffer[ofs], size, consumed);
+		} else {
+			err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		}
 		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
@@ -916,3 +1125,31 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	interest_grid.set_cell_size(p_size);
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_grid.get_cell_size();
+}
+
+void SceneReplicationInterface::set_peer_interest_position(int p_peer, const Vector3 &p_position) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer %d.", p_peer));
+	ERR_FAIL_COND_MSG(!p_position.is_finite(), "Interest position must be finite.");
+	info->interest_position = p_position;
+	info->has_interest_position = true;
+}
+
+Vector3 SceneReplicationInterface::get_peer_interest_position(int p_peer) const {
+	const PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_V_MSG(info, Vector3(), vformat("Unknown peer %d.", p_peer));
+	return info->interest_position;
+}
+
+void SceneReplicationInterface::clear_peer_interest_position(int p_peer) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer %d.", p_peer));
+	info->has_interest_position = false;
+}
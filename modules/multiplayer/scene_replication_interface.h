@@ -32,6 +32,8 @@
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
+#include "scene_interest_grid.h"
+#include "scene_replication_codec.h"
 
 #include "core/object/ref_counted.h"
 #include "core/templates/rb_set.h"
@@ -64,9 +66,14 @@ private:
 		HashSet<ObjectID> sync_nodes;
 		HashSet<ObjectID> spawn_nodes;
 		HashMap<ObjectID, uint64_t> last_watch_usecs;
+		HashMap<ObjectID, LocalVector<SceneReplicationCodec::Baseline>> delta_baselines;
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+		// Interest-managed synchronizers relevant to this peer.
+		HashSet<ObjectID> interest_nodes;
+		Vector3 interest_position;
+		bool has_interest_position = false;
 	};
 
 	// Replication state.
@@ -76,6 +83,10 @@ private:
 	RBSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
 
+	// Interest management (synchronizers with an interest radius).
+	HashSet<ObjectID> interest_syncs;
+	SceneInterestGrid interest_grid;
+
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
 
@@ -90,6 +101,7 @@ private:
 	SceneMultiplayer *multiplayer = nullptr;
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	PackedByteArray packet_cache;
+	LocalVector<uint8_t> codec_buffer;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
 
@@ -103,11 +115,17 @@ private:
 
 	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
 	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
+	Error _encode_quantized_state(const Vector<const Variant *> &p_values, const LocalVector<SceneReplicationConfig::Quantization> &p_quantization, uint64_t p_delta_indexes, LocalVector<SceneReplicationCodec::Baseline> *r_baselines);
+	Error _decode_quantized_state(Vector<Variant> &r_values, const LocalVector<SceneReplicationConfig::Quantization> &p_quantization, uint64_t p_delta_indexes, LocalVector<SceneReplicationCodec::Baseline> *r_baselines, const uint8_t *p_buffer, int p_len, int &r_len);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
 
 	void _visibility_changed(int p_peer, ObjectID p_oid);
+	bool _is_sync_visible_to(MultiplayerSynchronizer *p_sync, int p_peer) const;
+	static bool _get_interest_position(const Node *p_node, Vector3 &r_position);
+	void _update_interest_membership(MultiplayerSynchronizer *p_sync);
+	void _update_interest();
 	Error _update_sync_visibility(int p_peer, MultiplayerSynchronizer *p_sync);
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
@@ -146,6 +164,13 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
+	void set_peer_interest_position(int p_peer, const Vector3 &p_position);
+	Vector3 get_peer_interest_position(int p_peer) const;
+	void clear_peer_interest_position(int p_peer);
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -0,0 +1,324 @@
+/**************************************************************************/
+/*  loopback_multiplayer_peer.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_pcg.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/list.h"
+#include "core/templates/pair.h"
+#include "scene/main/multiplayer_peer.h"
+
+class LoopbackMultiplayerPeer;
+
+// In-process network connecting one server and any number of clients built
+// from LoopbackMultiplayerPeer instances. Time only moves forward when calling
+// advance(), so latency, loss and bandwidth simulations are repeatable.
+class LoopbackNetwork : public RefCounted {
+	GDCLASS(LoopbackNetwork, RefCounted);
+
+	friend class LoopbackMultiplayerPeer;
+
+	uint64_t time_usec = 0;
+	uint64_t latency_usec = 0;
+	float loss = 0.0;
+	int bandwidth = 0;
+	RandomPCG rng;
+	HashMap<int, LoopbackMultiplayerPeer *> peers;
+
+	Error _register(LoopbackMultiplayerPeer *p_peer, int p_id);
+	void _unregister(LoopbackMultiplayerPeer *p_peer);
+	void _notify(int p_to, int p_peer, bool p_connected);
+	Error _transmit(LoopbackMultiplayerPeer *p_from, int p_to, const uint8_t *p_buffer, int p_buffer_size);
+
+public:
+	void advance(uint64_t p_usec) { time_usec += p_usec; }
+	uint64_t get_time_usec() const { return time_usec; }
+
+	// One-way delay applied to every packet.
+	void set_latency_usec(uint64_t p_usec) { latency_usec = p_usec; }
+	uint64_t get_latency_usec() const { return latency_usec; }
+
+	// Probability of unreliable packets being dropped. Reliable packets are never lost.
+	void set_loss(float p_loss) { loss = CLAMP(p_loss, 0.0f, 1.0f); }
+	float get_loss() const { return loss; }
+
+	// Upload bandwidth of each peer in bytes per second, 0 means unlimited.
+	void set_bandwidth(int p_bytes_per_second) { bandwidth = MAX(p_bytes_per_second, 0); }
+	int get_bandwidth() const { return bandwidth; }
+
+	void set_seed(uint64_t p_seed) { rng.seed(p_seed); }
+
+	bool has_packets_in_flight() const;
+};
+
+class LoopbackMultiplayerPeer : public MultiplayerPeer {
+	GDCLASS(LoopbackMultiplayerPeer, MultiplayerPeer);
+
+public:
+	struct Packet {
+		int from = 0;
+		TransferMode mode = TRANSFER_MODE_RELIABLE;
+		int channel = 0;
+		uint64_t deliver_usec = 0;
+		Vector<uint8_t> data;
+	};
+
+	struct Stats {
+		uint64_t packets_sent = 0;
+		uint64_t bytes_sent = 0;
+		uint64_t packets_received = 0;
+		uint64_t bytes_received = 0;
+		uint64_t packets_dropped = 0;
+	};
+
+private:
+	friend class LoopbackNetwork;
+
+	Ref<LoopbackNetwork> network;
+	int unique_id = 0;
+	int target_peer = 0;
+	ConnectionStatus status = CONNECTION_DISCONNECTED;
+	HashSet<int> connected_peers;
+	List<Pair<int, bool>> pending_events; // Peer ID and whether it connected or disconnected.
+	List<Packet> in_flight; // Sorted by delivery time.
+	List<Packet> incoming;
+	Packet current_packet;
+	uint64_t uplink_free_usec = 0;
+	Stats stats;
+
+public:
+	Error create_server(const Ref<LoopbackNetwork> &p_network) {
+		ERR_FAIL_COND_V(network.is_valid(), ERR_ALREADY_IN_USE);
+		Error err = p_network->_register(this, TARGET_PEER_SERVER);
+		ERR_FAIL_COND_V(err != OK, err);
+		status = CONNECTION_CONNECTED;
+		return OK;
+	}
+
+	Error create_client(const Ref<LoopbackNetwork> &p_network, int p_id) {
+		ERR_FAIL_COND_V(network.is_valid(), ERR_ALREADY_IN_USE);
+		ERR_FAIL_COND_V(p_id <= TARGET_PEER_SERVER, ERR_INVALID_PARAMETER);
+		ERR_FAIL_COND_V_MSG(!p_network->peers.has(TARGET_PEER_SERVER), ERR_CANT_CONNECT, "The loopback network has no server.");
+		Error err = p_network->_register(this, p_id);
+		ERR_FAIL_COND_V(err != OK, err);
+		status = CONNECTION_CONNECTING;
+		p_network->_notify(TARGET_PEER_SERVER, p_id, true);
+		p_network->_notify(p_id, TARGET_PEER_SERVER, true);
+		return OK;
+	}
+
+	const Stats &get_stats() const { return stats; }
+	void reset_stats() { stats = Stats(); }
+	bool has_packets_in_flight() const { return !in_flight.is_empty(); }
+
+	virtual int get_available_packet_count() const override { return incoming.size(); }
+	virtual Error get_packet(const uint8_t **r_buffer, int &r_buffer_size) override {
+		ERR_FAIL_COND_V(incoming.is_empty(), ERR_UNAVAILABLE);
+		current_packet = incoming.front()->get();
+		incoming.pop_front();
+		*r_buffer = current_packet.data.ptr();
+		r_buffer_size = current_packet.data.size();
+		return OK;
+	}
+	virtual Error put_packet(const uint8_t *p_buffer, int p_buffer_size) override {
+		ERR_FAIL_COND_V(status != CONNECTION_CONNECTED, ERR_UNCONFIGURED);
+		if (target_peer > 0) {
+			ERR_FAIL_COND_V_MSG(!connected_peers.has(target_peer), ERR_INVALID_PARAMETER, vformat("Invalid target peer: %d", target_peer));
+			return network->_transmit(this, target_peer, p_buffer, p_buffer_size);
+		}
+		for (const int &P : connected_peers) {
+			if (target_peer < 0 && P == -target_peer) {
+				continue;
+			}
+			network->_transmit(this, P, p_buffer, p_buffer_size);
+		}
+		return OK;
+	}
+	virtual int get_max_packet_size() const override { return 1 << 24; }
+
+	virtual void set_target_peer(int p_peer_id) override { target_peer = p_peer_id; }
+	virtual int get_packet_peer() const override {
+		ERR_FAIL_COND_V(incoming.is_empty(), 0);
+		return incoming.front()->get().from;
+	}
+	virtual TransferMode get_packet_mode() const override {
+		ERR_FAIL_COND_V(incoming.is_empty(), TRANSFER_MODE_RELIABLE);
+		return incoming.front()->get().mode;
+	}
+	virtual int get_packet_channel() const override {
+		ERR_FAIL_COND_V(incoming.is_empty(), 0);
+		return incoming.front()->get().channel;
+	}
+	virtual bool is_server_relay_supported() const override { return true; }
+
+	virtual void disconnect_peer(int p_peer, bool p_force = false) override {
+		ERR_FAIL_COND(!connected_peers.has(p_peer));
+		network->_notify(p_peer, unique_id, false);
+		if (p_force) {
+			connected_peers.erase(p_peer);
+			if (!is_server()) {
+				status = CONNECTION_DISCONNECTED;
+			}
+		} else {
+			pending_events.push_back(Pair<int, bool>(p_peer, false));
+		}
+	}
+
+	virtual bool is_server() const override { return unique_id == TARGET_PEER_SERVER; }
+
+	virtual void poll() override {
+		ERR_FAIL_COND(network.is_null());
+		while (pending_events.size()) {
+			const Pair<int, bool> event = pending_events.front()->get();
+			pending_events.pop_front();
+			if (event.second) {
+				connected_peers.insert(event.first);
+				status = CONNECTION_CONNECTED;
+				emit_signal(SNAME("peer_connected"), event.first);
+			} else if (connected_peers.has(event.first)) {
+				connected_peers.erase(event.first);
+				if (!is_server()) {
+					status = CONNECTION_DISCONNECTED;
+				}
+				emit_signal(SNAME("peer_disconnected"), event.first);
+			}
+			if (network.is_null()) {
+				return; // Closed by a signal handler.
+			}
+		}
+		const uint64_t now = network->time_usec;
+		while (in_flight.size() && in_flight.front()->get().deliver_usec <= now) {
+			const Packet &packet = in_flight.front()->get();
+			// Packets from peers which disconnected while they were in transit are lost.
+			if (connected_peers.has(packet.from)) {
+				stats.packets_received++;
+				stats.bytes_received += packet.data.size();
+				incoming.push_back(packet);
+			}
+			in_flight.pop_front();
+		}
+	}
+
+	virtual void close() override {
+		if (network.is_valid()) {
+			for (const int &P : connected_peers) {
+				network->_notify(P, unique_id, false);
+			}
+			network->_unregister(this);
+			network.unref();
+		}
+		connected_peers.clear();
+		pending_events.clear();
+		in_flight.clear();
+		incoming.clear();
+		uplink_free_usec = 0;
+		unique_id = 0;
+		status = CONNECTION_DISCONNECTED;
+	}
+
+	virtual int get_unique_id() const override { return unique_id; }
+	virtual ConnectionStatus get_connection_status() const override { return status; }
+
+	~LoopbackMultiplayerPeer() {
+		close();
+	}
+};
+
+inline Error LoopbackNetwork::_register(LoopbackMultiplayerPeer *p_peer, int p_id) {
+	ERR_FAIL_COND_V_MSG(peers.has(p_id), ERR_ALREADY_IN_USE, vformat("Peer ID %d is already in use on this loopback network.", p_id));
+	peers.insert(p_id, p_peer);
+	p_peer->network = Ref<LoopbackNetwork>(this);
+	p_peer->unique_id = p_id;
+	return OK;
+}
+
+inline void LoopbackNetwork::_unregister(LoopbackMultiplayerPeer *p_peer) {
+	peers.erase(p_peer->unique_id);
+}
+
+inline void LoopbackNetwork::_notify(int p_to, int p_peer, bool p_connected) {
+	LoopbackMultiplayerPeer **peer = peers.getptr(p_to);
+	if (peer) {
+		(*peer)->pending_events.push_back(Pair<int, bool>(p_peer, p_connected));
+	}
+}
+
+inline Error LoopbackNetwork::_transmit(LoopbackMultiplayerPeer *p_from, int p_to, const uint8_t *p_buffer, int p_buffer_size) {
+	LoopbackMultiplayerPeer **to = peers.getptr(p_to);
+	ERR_FAIL_NULL_V(to, ERR_INVALID_PARAMETER);
+
+	p_from->stats.packets_sent++;
+	p_from->stats.bytes_sent += p_buffer_size;
+
+	// Packets queue up on the sender's uplink when bandwidth is limited.
+	uint64_t sent_usec = MAX(time_usec, p_from->uplink_free_usec);
+	if (bandwidth > 0) {
+		sent_usec += uint64_t(p_buffer_size) * 1000000 / bandwidth;
+	}
+	p_from->uplink_free_usec = sent_usec;
+
+	const MultiplayerPeer::TransferMode mode = p_from->get_transfer_mode();
+	if (mode != MultiplayerPeer::TRANSFER_MODE_RELIABLE && loss > 0 && rng.randf() < loss) {
+		p_from->stats.packets_dropped++;
+		return OK;
+	}
+
+	LoopbackMultiplayerPeer::Packet packet;
+	packet.from = p_from->unique_id;
+	packet.mode = mode;
+	packet.channel = p_from->get_transfer_channel();
+	packet.deliver_usec = sent_usec + latency_usec;
+	packet.data.resize(p_buffer_size);
+	memcpy(packet.data.ptrw(), p_buffer, p_buffer_size);
+
+	// Keep packets sorted by delivery time, preserving the send order of packets due at the same time.
+	List<LoopbackMultiplayerPeer::Packet> &in_flight = (*to)->in_flight;
+	List<LoopbackMultiplayerPeer::Packet>::Element *E = in_flight.back();
+	while (E && E->get().deliver_usec > packet.deliver_usec) {
+		E = E->prev();
+	}
+	if (E) {
+		in_flight.insert_after(E, packet);
+	} else {
+		in_flight.push_front(packet);
+	}
+	return OK;
+}
+
+inline bool LoopbackNetwork::has_packets_in_flight() const {
+	for (const KeyValue<int, LoopbackMultiplayerPeer *> &E : peers) {
+		if (E.value->has_packets_in_flight()) {
+			return true;
+		}
+	}
+	return false;
+}
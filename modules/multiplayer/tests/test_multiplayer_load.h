@@ -0,0 +1,421 @@
+/**************************************************************************/
+/*  test_multiplayer_load.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+#include "../multiplayer_synchronizer.h"
+#include "../scene_multiplayer.h"
+#include "loopback_multiplayer_peer.h"
+
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/window.h"
+
+namespace TestMultiplayerLoad {
+class LoadTestNode : public Node {
+	GDCLASS(LoadTestNode, Node);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("ping", "tick"), &LoadTestNode::ping);
+	}
+
+public:
+	int pings = 0;
+	int syncs = 0;
+
+	void ping(int p_tick) {
+		pings++;
+	}
+
+	void on_synchronized() {
+		syncs++;
+	}
+
+	LoadTestNode() {
+		set_name("Game");
+		Dictionary config;
+		config["rpc_mode"] = MultiplayerAPI::RPC_MODE_ANY_PEER;
+		config["transfer_mode"] = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		rpc_config(SNAME("ping"), config);
+	}
+};
+
+struct LoadTestSettings {
+	int clients = 8;
+	int entities = 64; // Owned by the server and synchronized to every client.
+	int rpcs_per_tick = 4; // Sent by each client to the server.
+	int ticks = 60;
+	uint64_t tick_usec = 16667;
+	uint64_t latency_usec = 0;
+	float loss = 0.0;
+	int bandwidth = 0; // Bytes per second, 0 means unlimited.
+	int quantization_bits = 0; // Bits per position component, 0 sends plain variants.
+	bool packet_batching = false;
+};
+
+struct LoadTestReport {
+	int ticks = 0;
+	uint64_t server_usec = 0;
+	uint64_t clients_usec = 0;
+	uint64_t max_tick_usec = 0;
+	uint64_t server_bytes_sent = 0;
+	uint64_t server_packets_sent = 0;
+	uint64_t client_bytes_sent = 0;
+	uint64_t client_bytes_received = 0;
+	uint64_t packets_dropped = 0;
+	int rpcs_sent = 0;
+	int rpcs_received = 0;
+	int syncs_received = 0;
+
+	String to_string(const LoadTestSettings &p_settings) const {
+		const double seconds = double(ticks) * p_settings.tick_usec / 1000000.0;
+		String out = vformat("%d clients, %d entities, %d ticks:", p_settings.clients, p_settings.entities, ticks);
+		out += vformat("\n\tCPU per tick: server %d usec, clients %d usec, worst tick %d usec.", server_usec / ticks, clients_usec / ticks, max_tick_usec);
+		out += vformat("\n\tServer sent: %s in %d packets (%s/s).", String::humanize_size(server_bytes_sent), server_packets_sent, String::humanize_size(server_bytes_sent / seconds));
+		out += vformat("\n\tPer client: sent %s, received %s (%s/s).", String::humanize_size(client_bytes_sent / p_settings.clients), String::humanize_size(client_bytes_received / p_settings.clients), String::humanize_size(client_bytes_received / p_settings.clients / seconds));
+		out += vformat("\n\tRPCs: %d sent, %d received (%d/s). Syncs received: %d. Packets dropped: %d.", rpcs_sent, rpcs_received, int(rpcs_received / seconds), syncs_received, packets_dropped);
+		return out;
+	}
+};
+
+// Runs one server and several clients in the current SceneTree, each with its
+// own SceneMultiplayer branch, connected through a LoopbackNetwork.
+class MultiplayerLoadTest {
+	struct Participant {
+		Ref<SceneMultiplayer> multiplayer;
+		Ref<LoopbackMultiplayerPeer> peer;
+		NodePath root_path;
+		Node *root = nullptr;
+		LoadTestNode *game = nullptr;
+		LocalVector<Node2D *> entities;
+	};
+
+	LoadTestSettings settings;
+	Ref<LoopbackNetwork> network;
+	Ref<SceneReplicationConfig> config;
+	LocalVector<Participant> participants; // The server comes first.
+
+	void _add_participant(int p_id) {
+		Participant participant;
+		participant.multiplayer.instantiate();
+		participant.multiplayer->set_packet_batching_enabled(settings.packet_batching);
+		participant.peer.instantiate();
+		if (p_id == MultiplayerPeer::TARGET_PEER_SERVER) {
+			participant.peer->create_server(network);
+		} else {
+			participant.peer->create_client(network, p_id);
+		}
+		participant.multiplayer->set_multiplayer_peer(participant.peer);
+
+		const String name = vformat("LoadTest%d", p_id);
+		participant.root_path = NodePath("/root/" + name);
+		SceneTree::get_singleton()->set_multiplayer(participant.multiplayer, participant.root_path);
+
+		participant.root = memnew(Node);
+		participant.root->set_name(name);
+		SceneTree::get_singleton()->get_root()->add_child(participant.root);
+		participant.game = memnew(LoadTestNode);
+		participant.root->add_child(participant.game);
+
+		for (int i = 0; i < settings.entities; i++) {
+			Node2D *entity = memnew(Node2D);
+			entity->set_name(vformat("Entity%d", i));
+			participant.game->add_child(entity);
+			MultiplayerSynchronizer *sync = memnew(MultiplayerSynchronizer);
+			sync->set_replication_config(config);
+			entity->add_child(sync);
+			if (p_id != MultiplayerPeer::TARGET_PEER_SERVER) {
+				sync->connect(SNAME("synchronized"), callable_mp(participant.game, &LoadTestNode::on_synchronized));
+			}
+			participant.entities.push_back(entity);
+		}
+		participants.push_back(participant);
+	}
+
+	uint64_t _poll_all(uint64_t &r_server_usec) {
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		participants[0].multiplayer->poll();
+		const uint64_t server_end = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 1; i < participants.size(); i++) {
+			participants[i].multiplayer->poll();
+		}
+		r_server_usec = server_end - begin;
+		return OS::get_singleton()->get_ticks_usec() - server_end;
+	}
+
+public:
+	// Polls until every peer knows about every other peer, or the simulated timeout expires.
+	bool connect_peers(uint64_t p_timeout_usec = 10000000) {
+		uint64_t server_usec = 0;
+		for (uint64_t elapsed = 0; elapsed < p_timeout_usec; elapsed += settings.tick_usec) {
+			network->advance(settings.tick_usec);
+			_poll_all(server_usec);
+			bool connected = true;
+			for (const Participant &participant : participants) {
+				if (participant.multiplayer->get_connected_peers().size() != uint32_t(settings.clients)) {
+					connected = false;
+					break;
+				}
+			}
+			if (connected) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	LoadTestReport run() {
+		LoadTestReport report;
+		for (Participant &participant : participants) {
+			participant.peer->reset_stats();
+		}
+		const int settle_ticks = int(settings.latency_usec / settings.tick_usec) + 2;
+		for (int tick = 0; tick < settings.ticks + settle_ticks; tick++) {
+			const bool active = tick < settings.ticks;
+			uint64_t rpc_usec = 0;
+			if (active) {
+				// Move the server entities, synchronizers pick the changes up on the next poll.
+				for (uint32_t i = 0; i < participants[0].entities.size(); i++) {
+					const real_t angle = tick * 0.05 + i;
+					participants[0].entities[i]->set_position(Vector2(Math::cos(angle), Math::sin(angle)) * 500);
+				}
+				const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				for (uint32_t i = 1; i < participants.size(); i++) {
+					for (int r = 0; r < settings.rpcs_per_tick; r++) {
+						if (participants[i].game->rpc_id(MultiplayerPeer::TARGET_PEER_SERVER, SNAME("ping"), tick) == OK) {
+							report.rpcs_sent++;
+						}
+					}
+				}
+				rpc_usec = OS::get_singleton()->get_ticks_usec() - begin;
+			} else if (!network->has_packets_in_flight()) {
+				break;
+			}
+
+			network->advance(settings.tick_usec);
+			uint64_t server_usec = 0;
+			const uint64_t clients_usec = _poll_all(server_usec) + rpc_usec;
+			if (active) {
+				report.ticks++;
+				report.server_usec += server_usec;
+				report.clients_usec += clients_usec;
+				report.max_tick_usec = MAX(report.max_tick_usec, server_usec + clients_usec);
+			}
+		}
+
+		const LoopbackMultiplayerPeer::Stats &server_stats = participants[0].peer->get_stats();
+		report.server_bytes_sent = server_stats.bytes_sent;
+		report.server_packets_sent = server_stats.packets_sent;
+		report.packets_dropped = server_stats.packets_dropped;
+		report.rpcs_received = participants[0].game->pings;
+		for (uint32_t i = 1; i < participants.size(); i++) {
+			const LoopbackMultiplayerPeer::Stats &stats = participants[i].peer->get_stats();
+			report.client_bytes_sent += stats.bytes_sent;
+			report.client_bytes_received += stats.bytes_received;
+			report.packets_dropped += stats.packets_dropped;
+			report.syncs_received += participants[i].game->syncs;
+		}
+		return report;
+	}
+
+	Vector2 get_entity_position(int p_participant, int p_entity) const {
+		return participants[p_participant].entities[p_entity]->get_position();
+	}
+
+	MultiplayerLoadTest(const LoadTestSettings &p_settings) {
+		settings = p_settings;
+		network.instantiate();
+		network->set_latency_usec(settings.latency_usec);
+		network->set_loss(settings.loss);
+		network->set_bandwidth(settings.bandwidth);
+
+		config.instantiate();
+		config->add_property(NodePath(":position"));
+		config->property_set_spawn(NodePath(":position"), false);
+		if (settings.quantization_bits > 0) {
+			config->property_set_quantization(NodePath(":position"), settings.quantization_bits, -1000, 1000);
+		}
+
+		_add_participant(MultiplayerPeer::TARGET_PEER_SERVER);
+		for (int i = 0; i < settings.clients; i++) {
+			_add_participant(i + 2);
+		}
+	}
+
+	~MultiplayerLoadTest() {
+		for (Participant &participant : participants) {
+			SceneTree::get_singleton()->get_root()->remove_child(participant.root);
+			memdelete(participant.root);
+			SceneTree::get_singleton()->set_multiplayer(Ref<MultiplayerAPI>(), participant.root_path);
+			participant.peer->close();
+		}
+	}
+};
+
+TEST_CASE("[Multiplayer][LoopbackMultiplayerPeer] Connection, latency and loss") {
+	Ref<LoopbackNetwork> network;
+	network.instantiate();
+	Ref<LoopbackMultiplayerPeer> server;
+	server.instantiate();
+	Ref<LoopbackMultiplayerPeer> client;
+	client.instantiate();
+
+	REQUIRE_EQ(server->create_server(network), OK);
+	REQUIRE_EQ(client->create_client(network, 2), OK);
+	CHECK_EQ(server->get_connection_status(), MultiplayerPeer::CONNECTION_CONNECTED);
+	CHECK_EQ(client->get_connection_status(), MultiplayerPeer::CONNECTION_CONNECTING);
+
+	SIGNAL_WATCH(server.ptr(), "peer_connected");
+	server->poll();
+	SIGNAL_CHECK("peer_connected", { { 2 } });
+	SIGNAL_UNWATCH(server.ptr(), "peer_connected");
+	client->poll();
+	CHECK_EQ(client->get_connection_status(), MultiplayerPeer::CONNECTION_CONNECTED);
+
+	const uint8_t data[4] = { 1, 2, 3, 4 };
+
+	SUBCASE("Packets are delivered after the configured latency") {
+		network->set_latency_usec(1000);
+		client->set_target_peer(1);
+		client->set_transfer_channel(3);
+		CHECK_EQ(client->put_packet(data, sizeof(data)), OK);
+
+		network->advance(999);
+		server->poll();
+		CHECK_EQ(server->get_available_packet_count(), 0);
+
+		network->advance(1);
+		server->poll();
+		REQUIRE_EQ(server->get_available_packet_count(), 1);
+		CHECK_EQ(server->get_packet_peer(), 2);
+		CHECK_EQ(server->get_packet_channel(), 3);
+		const uint8_t *buffer = nullptr;
+		int size = 0;
+		CHECK_EQ(server->get_packet(&buffer, size), OK);
+		CHECK_EQ(size, 4);
+		CHECK_EQ(buffer[3], 4);
+		CHECK_EQ(client->get_stats().bytes_sent, 4u);
+		CHECK_EQ(server->get_stats().bytes_received, 4u);
+	}
+
+	SUBCASE("Bandwidth delays packets queued on the same uplink") {
+		network->set_bandwidth(4000); // 1 msec per packet.
+		server->set_target_peer(2);
+		CHECK_EQ(server->put_packet(data, sizeof(data)), OK);
+		CHECK_EQ(server->put_packet(data, sizeof(data)), OK);
+
+		network->advance(1000);
+		client->poll();
+		CHECK_EQ(client->get_available_packet_count(), 1);
+		network->advance(1000);
+		client->poll();
+		CHECK_EQ(client->get_available_packet_count(), 2);
+	}
+
+	SUBCASE("Only unreliable packets are lost") {
+		network->set_loss(1.0);
+		server->set_target_peer(2);
+		server->set_transfer_mode(MultiplayerPeer::TRANSFER_MODE_UNRELIABLE);
+		CHECK_EQ(server->put_packet(data, sizeof(data)), OK);
+		server->set_transfer_mode(MultiplayerPeer::TRANSFER_MODE_RELIABLE);
+		CHECK_EQ(server->put_packet(data, sizeof(data)), OK);
+
+		client->poll();
+		REQUIRE_EQ(client->get_available_packet_count(), 1);
+		CHECK_EQ(client->get_packet_mode(), MultiplayerPeer::TRANSFER_MODE_RELIABLE);
+		CHECK_EQ(server->get_stats().packets_dropped, 1u);
+	}
+
+	SUBCASE("Closing the server disconnects clients") {
+		server->close();
+		SIGNAL_WATCH(client.ptr(), "peer_disconnected");
+		client->poll();
+		SIGNAL_CHECK("peer_disconnected", { { 1 } });
+		SIGNAL_UNWATCH(client.ptr(), "peer_disconnected");
+		CHECK_EQ(client->get_connection_status(), MultiplayerPeer::CONNECTION_DISCONNECTED);
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] Load test harness") {
+	LoadTestSettings settings;
+	settings.clients = 2;
+	settings.entities = 4;
+	settings.ticks = 20;
+	settings.latency_usec = 20000;
+
+	SUBCASE("Without batching") {
+	}
+	SUBCASE("With batching") {
+		settings.packet_batching = true;
+	}
+
+	MultiplayerLoadTest load_test(settings);
+	REQUIRE(load_test.connect_peers());
+	const LoadTestReport report = load_test.run();
+
+	CHECK_EQ(report.ticks, settings.ticks);
+	CHECK_EQ(report.rpcs_sent, settings.clients * settings.rpcs_per_tick * settings.ticks);
+	CHECK_EQ(report.rpcs_received, report.rpcs_sent);
+	CHECK(report.syncs_received > 0);
+	CHECK(report.server_bytes_sent > 0);
+	for (int i = 0; i < settings.entities; i++) {
+		CHECK(load_test.get_entity_position(1, i).is_equal_approx(load_test.get_entity_position(0, i)));
+	}
+}
+
+TEST_CASE_PENDING("[Multiplayer][SceneMultiplayer][SceneTree][Benchmark] Replication and RPC load with loopback peers") {
+	LoadTestSettings settings;
+	settings.clients = 32;
+	settings.entities = 256;
+	settings.ticks = 300;
+	settings.latency_usec = 50000;
+	settings.loss = 0.02;
+	settings.bandwidth = 1024 * 1024;
+
+	SUBCASE("Baseline") {
+	}
+	SUBCASE("Packet batching") {
+		settings.packet_batching = true;
+	}
+	SUBCASE("Packet batching and 16 bits quantization") {
+		settings.packet_batching = true;
+		settings.quantization_bits = 16;
+	}
+
+	MultiplayerLoadTest load_test(settings);
+	REQUIRE(load_test.connect_peers());
+	const LoadTestReport report = load_test.run();
+	MESSAGE(report.to_string(settings));
+}
+} // namespace TestMultiplayerLoad
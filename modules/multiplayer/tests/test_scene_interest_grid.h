@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  test_scene_interest_grid.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "../scene_interest_grid.h"
+
+namespace TestSceneInterestGrid {
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Relevance queries") {
+	SceneInterestGrid grid;
+	grid.set_cell_size(10);
+
+	const ObjectID near_id = ObjectID(uint64_t(1));
+	const ObjectID far_id = ObjectID(uint64_t(2));
+	const ObjectID large_id = ObjectID(uint64_t(3));
+	grid.update(near_id, Vector3(1, 1, 0), 5);
+	grid.update(far_id, Vector3(100, 0, 0), 5);
+	grid.update(large_id, Vector3(-30, 0, 0), 40);
+	CHECK(grid.size() == 3);
+
+	HashSet<ObjectID> relevant;
+	grid.query(Vector3(), relevant);
+	CHECK(relevant.size() == 2);
+	CHECK(relevant.has(near_id));
+	CHECK(relevant.has(large_id));
+	CHECK_FALSE(relevant.has(far_id));
+
+	CHECK(grid.is_relevant(far_id, Vector3(98, 0, 0)));
+	CHECK_FALSE(grid.is_relevant(far_id, Vector3(90, 0, 0)));
+
+	SUBCASE("Moving objects across cells") {
+		grid.update(far_id, Vector3(3, 0, 0), 5);
+		grid.update(near_id, Vector3(50, 50, 0), 5);
+		relevant.clear();
+		grid.query(Vector3(), relevant);
+		CHECK(relevant.size() == 2);
+		CHECK(relevant.has(far_id));
+		CHECK(relevant.has(large_id));
+
+		relevant.clear();
+		grid.query(Vector3(52, 48, 0), relevant);
+		CHECK(relevant.size() == 1);
+		CHECK(relevant.has(near_id));
+	}
+
+	SUBCASE("Removing objects") {
+		grid.remove(large_id);
+		CHECK_FALSE(grid.has(large_id));
+		relevant.clear();
+		grid.query(Vector3(), relevant);
+		CHECK(relevant.size() == 1);
+		CHECK(relevant.has(near_id));
+	}
+
+	SUBCASE("Changing the cell size keeps the objects") {
+		grid.set_cell_size(3);
+		relevant.clear();
+		grid.query(Vector3(), relevant);
+		CHECK(relevant.size() == 2);
+		CHECK(relevant.has(near_id));
+		CHECK(relevant.has(large_id));
+	}
+
+	SUBCASE("Objects near cell boundaries") {
+		// Relevant from the neighboring cells, but not beyond the radius.
+		grid.update(near_id, Vector3(9.9, 0, 0), 5);
+		relevant.clear();
+		grid.query(Vector3(14.8, 0, 0), relevant);
+		CHECK(relevant.has(near_id));
+		relevant.clear();
+		grid.query(Vector3(15, 0, 0), relevant);
+		CHECK_FALSE(relevant.has(near_id));
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneInterestGrid] Large radii and invalid values") {
+	SceneInterestGrid grid;
+	grid.set_cell_size(1);
+
+	// Radii spanning many cells don't fill the cells they cover.
+	const ObjectID huge_id = ObjectID(uint64_t(1));
+	const ObjectID small_id = ObjectID(uint64_t(2));
+	grid.update(huge_id, Vector3(), 1e6);
+	grid.update(small_id, Vector3(0.5, 0.5, 0), 1);
+
+	HashSet<ObjectID> relevant;
+	grid.query(Vector3(500000, -500000, 0), relevant);
+	CHECK(relevant.size() == 1);
+	CHECK(relevant.has(huge_id));
+
+	relevant.clear();
+	grid.query(Vector3(1, 1, 0), relevant);
+	CHECK(relevant.size() == 2);
+
+	// Points far outside of the grid range only see large objects.
+	relevant.clear();
+	grid.query(Vector3(1e20, 0, 0), relevant);
+	CHECK(relevant.is_empty());
+	grid.update(small_id, Vector3(1e20, 0, 0), 1);
+	relevant.clear();
+	grid.query(Vector3(1e20, 0, 0), relevant);
+	CHECK(relevant.size() == 1);
+	CHECK(relevant.has(small_id));
+
+	ERR_PRINT_OFF;
+	grid.update(small_id, Vector3(Math::NaN, 0, 0), 1);
+	CHECK_FALSE(grid.has(small_id));
+	grid.update(small_id, Vector3(), Math::INF);
+	CHECK_FALSE(grid.has(small_id));
+	grid.update(small_id, Vector3(), 0);
+	CHECK_FALSE(grid.has(small_id));
+	grid.set_cell_size(0);
+	CHECK(grid.get_cell_size() == 1);
+	ERR_PRINT_ON;
+
+	relevant.clear();
+	grid.query(Vector3(Math::NaN, 0, 0), relevant);
+	CHECK(relevant.is_empty());
+	CHECK(grid.size() == 1);
+}
+
+} // namespace TestSceneInterestGrid
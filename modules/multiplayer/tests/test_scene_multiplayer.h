@@ -35,7 +35,60 @@
 
 #include "../scene_multiplayer.h"
 
+#include "core/io/marshalls.h"
+
 namespace TestSceneMultiplayer {
+// Records outgoing packets and hands out the packets queued in `incoming`.
+class RecordingMultiplayerPeer : public MultiplayerPeer {
+	GDCLASS(RecordingMultiplayerPeer, MultiplayerPeer);
+
+public:
+	struct Packet {
+		int peer = 0;
+		TransferMode mode = TRANSFER_MODE_RELIABLE;
+		int channel = 0;
+		Vector<uint8_t> data;
+	};
+
+	int unique_id = TARGET_PEER_SERVER;
+	int target_peer = 0;
+	List<Packet> incoming;
+	Vector<Packet> outgoing;
+	Packet current;
+
+	virtual int get_available_packet_count() const override { return incoming.size(); }
+	virtual Error get_packet(const uint8_t **r_buffer, int &r_buffer_size) override {
+		ERR_FAIL_COND_V(incoming.is_empty(), ERR_UNAVAILABLE);
+		current = incoming.front()->get();
+		incoming.pop_front();
+		*r_buffer = current.data.ptr();
+		r_buffer_size = current.data.size();
+		return OK;
+	}
+	virtual Error put_packet(const uint8_t *p_buffer, int p_buffer_size) override {
+		Packet packet;
+		packet.peer = target_peer;
+		packet.mode = get_transfer_mode();
+		packet.channel = get_transfer_channel();
+		packet.data.resize(p_buffer_size);
+		memcpy(packet.data.ptrw(), p_buffer, p_buffer_size);
+		outgoing.push_back(packet);
+		return OK;
+	}
+	virtual int get_max_packet_size() const override { return 1 << 24; }
+
+	virtual void set_target_peer(int p_peer_id) override { target_peer = p_peer_id; }
+	virtual int get_packet_peer() const override { return incoming.is_empty() ? 0 : incoming.front()->get().peer; }
+	virtual TransferMode get_packet_mode() const override { return incoming.is_empty() ? TRANSFER_MODE_RELIABLE : incoming.front()->get().mode; }
+	virtual int get_packet_channel() const override { return incoming.is_empty() ? 0 : incoming.front()->get().channel; }
+	virtual void disconnect_peer(int p_peer, bool p_force = false) override {}
+	virtual bool is_server() const override { return unique_id == TARGET_PEER_SERVER; }
+	virtual void poll() override {}
+	virtual void close() override {}
+	virtual int get_unique_id() const override { return unique_id; }
+	virtual ConnectionStatus get_connection_status() const override { return CONNECTION_CONNECTED; }
+};
+
 TEST_CASE("[Multiplayer][SceneMultiplayer] Defaults") {
 	Ref<SceneMultiplayer> scene_multiplayer;
 	scene_multiplayer.instantiate();
@@ -54,6 +107,8 @@ TEST_CASE("[Multiplayer][SceneMultiplayer] Defaults") {
 	CHECK(scene_multiplayer->is_server_relay_enabled());
 	CHECK_EQ(scene_multiplayer->get_max_sync_packet_size(), 1350);
 	CHECK_EQ(scene_multiplayer->get_max_delta_packet_size(), 65535);
+	CHECK_FALSE(scene_multiplayer->is_packet_batching_enabled());
+	CHECK_EQ(scene_multiplayer->get_max_batch_size(), 1200);
 	CHECK(scene_multiplayer->is_server());
 }
 
@@ -267,4 +322,111 @@ TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] Complete Authentication")
 	}
 }
 
+TEST_CASE("[Multiplayer][SceneMultiplayer] Packet batching") {
+	Ref<SceneMultiplayer> server;
+	server.instantiate();
+	server->set_root_path(NodePath("/root"));
+	Ref<RecordingMultiplayerPeer> server_peer;
+	server_peer.instantiate();
+	server->set_multiplayer_peer(server_peer);
+	server_peer->emit_signal(SNAME("peer_connected"), 2);
+	REQUIRE(server->get_connected_peers().has(2));
+
+	const Vector<uint8_t> first = { 1, 2, 3 };
+	const Vector<uint8_t> second = { 4, 5 };
+
+	SUBCASE("Packets are sent immediately when disabled") {
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		CHECK_EQ(server->send_bytes(second, 2), OK);
+		CHECK_EQ(server_peer->outgoing.size(), 2);
+	}
+
+	SUBCASE("Messages are packed into a single packet and unpacked by the receiver") {
+		server->set_packet_batching_enabled(true);
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		CHECK_EQ(server->send_bytes(second, 2), OK);
+		CHECK(server_peer->outgoing.is_empty());
+
+		CHECK_EQ(server->poll(), OK);
+		REQUIRE_EQ(server_peer->outgoing.size(), 1);
+		const RecordingMultiplayerPeer::Packet &batch = server_peer->outgoing[0];
+		CHECK_EQ(batch.peer, 2);
+		CHECK_EQ(batch.mode, MultiplayerPeer::TRANSFER_MODE_RELIABLE);
+		CHECK_EQ(batch.channel, 0);
+		REQUIRE_EQ(batch.data.size(), SceneMultiplayer::SYS_CMD_SIZE + 2 * SceneMultiplayer::BATCH_ENTRY_HEADER_SIZE + (first.size() + 1) + (second.size() + 1));
+		CHECK_EQ(batch.data[0], SceneMultiplayer::NETWORK_COMMAND_SYS);
+		CHECK_EQ(batch.data[1], SceneMultiplayer::SYS_COMMAND_BATCH);
+		CHECK_EQ(decode_uint32(&batch.data[2]), 2u);
+
+		Ref<SceneMultiplayer> client;
+		client.instantiate();
+		client->set_root_path(NodePath("/root"));
+		Ref<RecordingMultiplayerPeer> client_peer;
+		client_peer.instantiate();
+		client_peer->unique_id = 2;
+		client->set_multiplayer_peer(client_peer);
+		client_peer->emit_signal(SNAME("peer_connected"), 1);
+
+		RecordingMultiplayerPeer::Packet received = batch;
+		received.peer = 1;
+		client_peer->incoming.push_back(received);
+
+		SIGNAL_WATCH(client.ptr(), "peer_packet");
+		CHECK_EQ(client->poll(), OK);
+		SIGNAL_CHECK("peer_packet", Array({ { 1, first }, { 1, second } }));
+		SIGNAL_UNWATCH(client.ptr(), "peer_packet");
+	}
+
+	SUBCASE("Each transfer mode and channel gets its own packet") {
+		server->set_packet_batching_enabled(true);
+		CHECK_EQ(server->send_bytes(first, 2, MultiplayerPeer::TRANSFER_MODE_RELIABLE, 0), OK);
+		CHECK_EQ(server->send_bytes(first, 2, MultiplayerPeer::TRANSFER_MODE_UNRELIABLE, 0), OK);
+		CHECK_EQ(server->send_bytes(first, 2, MultiplayerPeer::TRANSFER_MODE_RELIABLE, 1), OK);
+		CHECK_EQ(server->send_bytes(second, 2, MultiplayerPeer::TRANSFER_MODE_RELIABLE, 1), OK);
+
+		CHECK_EQ(server->poll(), OK);
+		REQUIRE_EQ(server_peer->outgoing.size(), 3);
+		// Lone messages are sent without the batch framing.
+		CHECK_EQ(server_peer->outgoing[0].data[0], SceneMultiplayer::NETWORK_COMMAND_RAW);
+		CHECK_EQ(server_peer->outgoing[1].mode, MultiplayerPeer::TRANSFER_MODE_UNRELIABLE);
+		CHECK_EQ(server_peer->outgoing[1].data[0], SceneMultiplayer::NETWORK_COMMAND_RAW);
+		CHECK_EQ(server_peer->outgoing[2].channel, 1);
+		CHECK_EQ(server_peer->outgoing[2].data[1], SceneMultiplayer::SYS_COMMAND_BATCH);
+	}
+
+	SUBCASE("Batches are flushed when full") {
+		server->set_packet_batching_enabled(true);
+		// Room for the header and two 4 bytes messages.
+		server->set_max_batch_size(SceneMultiplayer::SYS_CMD_SIZE + 2 * (SceneMultiplayer::BATCH_ENTRY_HEADER_SIZE + 4));
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		CHECK(server_peer->outgoing.is_empty());
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		REQUIRE_EQ(server_peer->outgoing.size(), 1);
+		CHECK_EQ(decode_uint32(&server_peer->outgoing[0].data[2]), 2u);
+
+		// Messages larger than a batch are sent on their own.
+		const Vector<uint8_t> large = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+		CHECK_EQ(server->send_bytes(large, 2), OK);
+		REQUIRE_EQ(server_peer->outgoing.size(), 3);
+		CHECK_EQ(server_peer->outgoing[1].data[0], SceneMultiplayer::NETWORK_COMMAND_RAW);
+		CHECK_EQ(server_peer->outgoing[2].data.size(), large.size() + 1);
+	}
+
+	SUBCASE("Disabling flushes pending messages") {
+		server->set_packet_batching_enabled(true);
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		server->set_packet_batching_enabled(false);
+		CHECK_EQ(server_peer->outgoing.size(), 1);
+	}
+
+	SUBCASE("Pending messages are dropped when the peer disconnects") {
+		server->set_packet_batching_enabled(true);
+		CHECK_EQ(server->send_bytes(first, 2), OK);
+		server_peer->emit_signal(SNAME("peer_disconnected"), 2);
+		CHECK_EQ(server->poll(), OK);
+		CHECK(server_peer->outgoing.is_empty());
+	}
+}
+
 } // namespace TestSceneMultiplayer
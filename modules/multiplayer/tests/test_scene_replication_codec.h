@@ -0,0 +1,175 @@
+/**************************************************************************/
+/*  test_scene_replication_codec.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "tests/test_macros.h"
+
+#include "../scene_replication_codec.h"
+#include "scene/main/multiplayer_api.h"
+
+namespace TestSceneReplicationCodec {
+
+static Error encode_state(const Vector<Variant> &p_values, const LocalVector<SceneReplicationConfig::Quantization> &p_quantization, LocalVector<SceneReplicationCodec::Baseline> *r_baselines, LocalVector<uint8_t> &r_buffer) {
+	LocalVector<SceneReplicationCodec::EncodeField> fields;
+	for (int i = 0; i < p_values.size(); i++) {
+		SceneReplicationCodec::EncodeField field;
+		field.value = &p_values[i];
+		field.quantization = &p_quantization[i];
+		field.baseline = r_baselines ? &(*r_baselines)[i] : nullptr;
+		fields.push_back(field);
+	}
+	r_buffer.clear();
+	return SceneReplicationCodec::encode(fields, r_buffer);
+}
+
+static Error decode_state(Vector<Variant> &r_values, const LocalVector<SceneReplicationConfig::Quantization> &p_quantization, LocalVector<SceneReplicationCodec::Baseline> *r_baselines, const LocalVector<uint8_t> &p_buffer) {
+	LocalVector<SceneReplicationCodec::DecodeField> fields;
+	Variant *values = r_values.ptrw();
+	for (int i = 0; i < r_values.size(); i++) {
+		SceneReplicationCodec::DecodeField field;
+		field.value = &values[i];
+		field.quantization = &p_quantization[i];
+		field.baseline = r_baselines ? &(*r_baselines)[i] : nullptr;
+		fields.push_back(field);
+	}
+	int consumed = 0;
+	Error err = SceneReplicationCodec::decode(fields, p_buffer.ptr(), p_buffer.size(), consumed);
+	if (err == OK) {
+		CHECK(consumed == int(p_buffer.size()));
+	}
+	return err;
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Quantized values") {
+	LocalVector<SceneReplicationConfig::Quantization> quantization;
+	quantization.resize(5);
+	quantization[0].bits = 16;
+	quantization[0].range_min = -1000;
+	quantization[0].range_max = 1000;
+	quantization[1].bits = 12;
+	quantization[2].bits = 0; // Not quantized.
+	quantization[3].bits = 8;
+	quantization[3].range_min = 0;
+	quantization[3].range_max = 1;
+	quantization[4].bits = 10; // Not a quantizable type.
+
+	Vector<Variant> values;
+	values.push_back(Vector3(12.5, -300.25, 999));
+	values.push_back(Quaternion(Vector3(0, 1, 0), 1.2));
+	values.push_back("unchanged");
+	values.push_back(Color(0.2, 0.4, 0.6, 1.0));
+	values.push_back(42);
+
+	LocalVector<uint8_t> buffer;
+	REQUIRE(encode_state(values, quantization, nullptr, buffer) == OK);
+
+	// Smaller than the regular encoding.
+	Vector<const Variant *> varp;
+	for (const Variant &value : values) {
+		varp.push_back(&value);
+	}
+	int regular_size = 0;
+	MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, regular_size);
+	CHECK(int(buffer.size()) < regular_size);
+
+	Vector<Variant> decoded;
+	decoded.resize(values.size());
+	REQUIRE(decode_state(decoded, quantization, nullptr, buffer) == OK);
+
+	const real_t step = 2000.0 / 65535.0;
+	const Vector3 position = decoded[0];
+	CHECK(position.distance_to(Vector3(12.5, -300.25, 999)) < step);
+
+	const Quaternion rotation = decoded[1];
+	CHECK(rotation.is_normalized());
+	CHECK(Math::abs(rotation.dot(values[1])) > 0.999);
+
+	CHECK(decoded[2] == values[2]);
+
+	const Color color = decoded[3];
+	CHECK(Math::abs(color.r - 0.2) < 1.0 / 255.0);
+	CHECK(color.a == 1.0);
+
+	CHECK(decoded[4] == Variant(42));
+
+	// Values outside the range are clamped.
+	values.write[0] = Vector3(5000, -5000, 0);
+	REQUIRE(encode_state(values, quantization, nullptr, buffer) == OK);
+	REQUIRE(decode_state(decoded, quantization, nullptr, buffer) == OK);
+	CHECK(Vector3(decoded[0]).distance_to(Vector3(1000, -1000, 0)) < step);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationCodec] Delta against baselines") {
+	LocalVector<SceneReplicationConfig::Quantization> quantization;
+	quantization.resize(1);
+	quantization[0].bits = 20;
+	quantization[0].range_min = -1000;
+	quantization[0].range_max = 1000;
+
+	LocalVector<SceneReplicationCodec::Baseline> sender;
+	LocalVector<SceneReplicationCodec::Baseline> receiver;
+	sender.resize(1);
+	receiver.resize(1);
+
+	Vector<Variant> values;
+	values.push_back(Vector3(10, 20, 30));
+	Vector<Variant> decoded;
+	decoded.resize(1);
+
+	LocalVector<uint8_t> buffer;
+	REQUIRE(encode_state(values, quantization, &sender, buffer) == OK);
+	const uint32_t full_size = buffer.size();
+	REQUIRE(decode_state(decoded, quantization, &receiver, buffer) == OK);
+	CHECK(Vector3(decoded[0]).distance_to(Vector3(10, 20, 30)) < 0.01);
+
+	// Small movements only send the difference.
+	values.write[0] = Vector3(10.1, 20, 29.9);
+	REQUIRE(encode_state(values, quantization, &sender, buffer) == OK);
+	CHECK(buffer.size() < full_size);
+	REQUIRE(decode_state(decoded, quantization, &receiver, buffer) == OK);
+	CHECK(Vector3(decoded[0]).distance_to(Vector3(10.1, 20, 29.9)) < 0.01);
+
+	// Large movements fall back to the full value.
+	values.write[0] = Vector3(-900, 900, 0);
+	REQUIRE(encode_state(values, quantization, &sender, buffer) == OK);
+	REQUIRE(decode_state(decoded, quantization, &receiver, buffer) == OK);
+	CHECK(Vector3(decoded[0]).distance_to(Vector3(-900, 900, 0)) < 0.01);
+
+	// A receiver without the previous value rejects deltas.
+	values.write[0] = Vector3(-900, 900, 1);
+	REQUIRE(encode_state(values, quantization, &sender, buffer) == OK);
+	receiver[0] = SceneReplicationCodec::Baseline();
+	ERR_PRINT_OFF;
+	CHECK(decode_state(decoded, quantization, &receiver, buffer) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+}
+
+} // namespace TestSceneReplicationCodec
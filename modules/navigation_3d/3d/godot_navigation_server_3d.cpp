@@ -1215,6 +1215,14 @@ void GodotNavigationServer3D::bake_from_source_geometry_data_async(const Ref<Nav
 	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback);
 }
 
+void GodotNavigationServer3D::bake_from_source_geometry_data_tiled(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data_tiled(p_navigation_mesh, p_source_geometry_data, p_changed_aabb, p_callback);
+}
+
 bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const {
 	return NavMeshGenerator3D::get_singleton()->is_baking(p_navigation_mesh);
 }
@@ -1457,6 +1465,36 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results) {
+	ERR_FAIL_COND(p_query_parameters.size() != p_query_results.size());
+
+	struct MapQueries {
+		LocalVector<Ref<NavigationPathQueryParameters3D>> parameters;
+		LocalVector<Ref<NavigationPathQueryResult3D>> results;
+	};
+
+	// Queries are usually all made against the same map, but each map needs its own batch.
+	HashMap<NavMap3D *, MapQueries> map_queries;
+
+	for (int i = 0; i < p_query_parameters.size(); i++) {
+		Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[i];
+		ERR_CONTINUE(query_parameters.is_null());
+		ERR_CONTINUE(query_result.is_null());
+
+		NavMap3D *map = map_owner.get_or_null(query_parameters->get_map());
+		ERR_CONTINUE(map == nullptr);
+
+		MapQueries &queries = map_queries[map];
+		queries.parameters.push_back(query_parameters);
+		queries.results.push_back(query_result);
+	}
+
+	for (KeyValue<NavMap3D *, MapQueries> &E : map_queries) {
+		NavMeshQueries3D::map_query_paths(E.key, E.value.parameters, E.value.results);
+	}
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/thread.h"
+#include "core/templates/hashfuncs.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
 #include "scene/resources/navigation_mesh.h"
@@ -48,6 +49,8 @@ bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashMap<Ref<NavigationMesh>, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D *> NavMeshGenerator3D::tile_caches;
 
 static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MAX] = {
 	"",
@@ -136,6 +139,12 @@ void NavMeshGenerator3D::cleanup() {
 		generator_parsers_rwlock.write_lock();
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
+
+		MutexLock tile_cache_lock(tile_cache_mutex);
+		for (KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+			memdelete(E.value);
+		}
+		tile_caches.clear();
 	}
 }
 
@@ -195,6 +204,49 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	p_navigation_mesh->emit_changed();
 }
 
+void NavMeshGenerator3D::bake_from_source_geometry_data_tiled(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND(p_source_geometry_data.is_null());
+
+	if (p_navigation_mesh->get_tile_size() <= 0.0) {
+		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
+		return;
+	}
+
+	if (!p_source_geometry_data->has_data()) {
+		p_navigation_mesh->clear();
+		if (p_callback.is_valid()) {
+			generator_emit_callback(p_callback);
+		}
+		p_navigation_mesh->emit_changed();
+		return;
+	}
+
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
+	}
+	baking_navmesh_mutex.lock();
+	NavMeshGeneratorTask3D generator_task;
+	baking_navmeshes.insert(p_navigation_mesh, &generator_task);
+	baking_navmesh_mutex.unlock();
+
+	generator_task.navigation_mesh = p_navigation_mesh;
+	generator_task.source_geometry_data = p_source_geometry_data;
+	generator_task.status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
+
+	generator_bake_tiles_from_source_geometry_data(&generator_task, p_changed_aabb);
+
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.erase(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	if (p_callback.is_valid()) {
+		generator_emit_callback(p_callback);
+	}
+
+	p_navigation_mesh->emit_changed();
+}
+
 void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
@@ -322,12 +374,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
 	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
 
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
 
@@ -342,50 +389,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 	rcConfig cfg;
 	memset(&cfg, 0, sizeof(cfg));
 
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
+	generator_get_config(p_navigation_mesh, cfg);
+
 	if (p_navigation_mesh->get_border_size() > 0.0) {
 		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
 	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
-
-	if (p_navigation_mesh->get_border_size() > 0.0 && !Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()))) {
-		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
-		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
-		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
-		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
-		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
-		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
-		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
-		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
-	}
-	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
-		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
-	}
 
 	cfg.bmin[0] = bmin[0];
 	cfg.bmin[1] = bmin[1];
@@ -419,48 +427,124 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+	if (!generator_build_detail_mesh(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, &p_generator_task->bake_state, &detail_mesh)) {
+		return;
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	generator_convert_detail_mesh(detail_mesh, nav_vertices, nav_polygons);
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+
+	rcFreePolyMeshDetail(detail_mesh);
+	detail_mesh = nullptr;
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
+void NavMeshGenerator3D::generator_get_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg) {
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+
+	if (p_navigation_mesh->get_border_size() > 0.0 && !Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()))) {
+		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
+		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
+		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
+	}
+	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
+		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
+	}
+}
+
+bool NavMeshGenerator3D::generator_build_detail_mesh(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState *r_bake_state, rcPolyMeshDetail **r_detail_mesh) {
+	// Tiles are baked in parallel and don't report their individual progress.
+	NavMeshBakeState unused_bake_state;
+	NavMeshBakeState &bake_state = r_bake_state ? *r_bake_state : unused_bake_state;
+
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
+	bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
+	bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -475,13 +559,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
+	bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -496,68 +580,70 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
+	bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
+	bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
+	bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
 	rcFreeContourSet(cset);
 	cset = nullptr;
+	rcFreePolyMesh(poly_mesh);
+	poly_mesh = nullptr;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
-
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
+	*r_detail_mesh = detail_mesh;
+	return true;
+}
 
+void NavMeshGenerator3D::generator_convert_detail_mesh(const rcPolyMeshDetail *p_detail_mesh, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
-	recast_index_to_native_index.resize(detail_mesh->nverts);
+	recast_index_to_native_index.resize(p_detail_mesh->nverts);
 
-	for (int i = 0; i < detail_mesh->nverts; i++) {
-		const float *v = &detail_mesh->verts[i * 3];
+	for (int i = 0; i < p_detail_mesh->nverts; i++) {
+		const float *v = &p_detail_mesh->verts[i * 3];
 		const Vector3 vertex = Vector3(v[0], v[1], v[2]);
 		int *existing_index_ptr = recast_vertex_to_native_index.getptr(vertex);
 		if (!existing_index_ptr) {
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
 	}
 
-	for (int i = 0; i < detail_mesh->nmeshes; i++) {
-		const unsigned int *detail_mesh_m = &detail_mesh->meshes[i * 4];
+	for (int i = 0; i < p_detail_mesh->nmeshes; i++) {
+		const unsigned int *detail_mesh_m = &p_detail_mesh->meshes[i * 4];
 		const unsigned int detail_mesh_bverts = detail_mesh_m[0];
 		const unsigned int detail_mesh_m_btris = detail_mesh_m[2];
 		const unsigned int detail_mesh_ntris = detail_mesh_m[3];
-		const unsigned char *detail_mesh_tris = &detail_mesh->tris[detail_mesh_m_btris * 4];
+		const unsigned char *detail_mesh_tris = &p_detail_mesh->tris[detail_mesh_m_btris * 4];
 		for (unsigned int j = 0; j < detail_mesh_ntris; j++) {
 			Vector<int> nav_indices;
 			nav_indices.resize(3);
@@ -570,20 +656,333 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
+}
+
+void NavMeshGenerator3D::generator_bake_tiles_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task, const AABB &p_changed_aabb) {
+	Ref<NavigationMesh> p_navigation_mesh = p_generator_task->navigation_mesh;
+	const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data = p_generator_task->source_geometry_data;
+
+	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
+		return;
+	}
+
+	NavMeshTileBake3D tile_bake;
+	tile_bake.navigation_mesh = p_navigation_mesh;
+
+	p_source_geometry_data->get_data(
+			tile_bake.vertices,
+			tile_bake.indices,
+			tile_bake.projected_obstructions);
+
+	if (tile_bake.vertices.size() < 3 || tile_bake.indices.size() < 3) {
+		return;
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
+
+	rcConfig cfg;
+	memset(&cfg, 0, sizeof(cfg));
+	tile_bake.cfg = &cfg;
+
+	generator_get_config(p_navigation_mesh, cfg);
+
+	// Tiles need enough border for the erosion and the region partitioning to see the neighbor geometry.
+	cfg.tileSize = (int)Math::ceil(p_navigation_mesh->get_tile_size() / cfg.cs);
+	cfg.borderSize = cfg.walkableRadius + 3;
+	cfg.width = cfg.tileSize + cfg.borderSize * 2;
+	cfg.height = cfg.tileSize + cfg.borderSize * 2;
+
+	uint32_t config_hash = hash_murmur3_buffer(&cfg, sizeof(rcConfig));
+	config_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_low_hanging_obstacles(), config_hash);
+	config_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_ledge_spans(), config_hash);
+	config_hash = hash_murmur3_one_32(p_navigation_mesh->get_filter_walkable_low_height_spans(), config_hash);
+	config_hash = hash_murmur3_one_32(p_navigation_mesh->get_sample_partition_type(), config_hash);
+
+	const real_t tile_world_size = cfg.tileSize * cfg.cs;
+	const real_t border_world_size = cfg.borderSize * cfg.cs;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(tile_bake.vertices.ptr(), tile_bake.vertices.size() / 3, bmin, bmax);
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		for (int i = 0; i < 3; i++) {
+			bmin[i] = baking_aabb.position[i] + baking_aabb_offset[i];
+			bmax[i] = bmin[i] + baking_aabb.size[i];
+		}
+	}
+
+	// All tiles share a world aligned height range, so vertices on tile borders end up on the same cell heights.
+	cfg.bmin[1] = Math::floor(bmin[1] / cfg.ch) * cfg.ch;
+	cfg.bmax[1] = Math::ceil(bmax[1] / cfg.ch) * cfg.ch + cfg.ch;
+
+	const Rect2i tile_range = Rect2i(
+			Point2i((int)Math::floor(bmin[0] / tile_world_size), (int)Math::floor(bmin[2] / tile_world_size)),
+			Size2i((int)Math::floor(bmax[0] / tile_world_size) - (int)Math::floor(bmin[0] / tile_world_size) + 1, (int)Math::floor(bmax[2] / tile_world_size) - (int)Math::floor(bmin[2] / tile_world_size) + 1));
+
+	NavMeshTileCache3D *tile_cache = nullptr;
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+
+		// Drop the tiles of navigation meshes that no longer exist.
+		LocalVector<ObjectID> freed_navigation_meshes;
+		for (const KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+			if (ObjectDB::get_instance(E.key) == nullptr) {
+				freed_navigation_meshes.push_back(E.key);
+			}
+		}
+		for (const ObjectID &freed_navigation_mesh : freed_navigation_meshes) {
+			memdelete(tile_caches[freed_navigation_mesh]);
+			tile_caches.erase(freed_navigation_mesh);
+		}
+
+		NavMeshTileCache3D **tile_cache_ptr = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+		if (tile_cache_ptr) {
+			tile_cache = *tile_cache_ptr;
+		} else {
+			tile_cache = memnew(NavMeshTileCache3D);
+			tile_caches.insert(p_navigation_mesh->get_instance_id(), tile_cache);
+		}
+	}
+
+	const bool full_rebake = tile_cache->config_hash != config_hash || !p_changed_aabb.has_surface();
+	if (tile_cache->config_hash != config_hash) {
+		tile_cache->tiles.clear();
+		tile_cache->config_hash = config_hash;
+	}
+
+	// Geometry changes reach as far as the tile border into the neighbor tiles.
+	const AABB changed_aabb = p_changed_aabb.grow(border_world_size);
+
+	LocalVector<Vector2i> removed_tiles;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : tile_cache->tiles) {
+		if (!tile_range.encloses(Rect2i(E.key, Size2i(1, 1)))) {
+			removed_tiles.push_back(E.key);
+		}
+	}
+	for (const Vector2i &removed_tile : removed_tiles) {
+		tile_cache->tiles.erase(removed_tile);
+	}
+
+	for (int z = tile_range.position.y; z < tile_range.get_end().y; z++) {
+		for (int x = tile_range.position.x; x < tile_range.get_end().x; x++) {
+			const Vector2i tile_coords = Vector2i(x, z);
+			if (!full_rebake && tile_cache->tiles.has(tile_coords)) {
+				const Rect2 tile_rect = Rect2(tile_coords.x * tile_world_size, tile_coords.y * tile_world_size, tile_world_size, tile_world_size);
+				const Rect2 changed_rect = Rect2(changed_aabb.position.x, changed_aabb.position.z, changed_aabb.size.x, changed_aabb.size.z);
+				if (!tile_rect.intersects(changed_rect, true)) {
+					continue;
+				}
+			}
+			tile_bake.tile_coords.push_back(tile_coords);
+		}
+	}
+
+	tile_bake.tiles.resize(tile_bake.tile_coords.size());
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // steps #3 - #9 for each tile.
+
+	if (use_threads && tile_bake.tile_coords.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, &tile_bake, tile_bake.tile_coords.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tile_bake.tile_coords.size(); i++) {
+			generator_thread_bake_tile(&tile_bake, i);
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	for (uint32_t i = 0; i < tile_bake.tile_coords.size(); i++) {
+		tile_cache->tiles[tile_bake.tile_coords[i]] = tile_bake.tiles[i];
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	generator_merge_tiles(tile_cache, tile_world_size, p_navigation_mesh->get_agent_max_climb() + cfg.ch, nav_vertices, nav_polygons);
 
 	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshTileBake3D *tile_bake = static_cast<NavMeshTileBake3D *>(p_arg);
+	const Vector2i &tile_coords = tile_bake->tile_coords[p_index];
+	NavMeshTile3D &tile = tile_bake->tiles[p_index];
+
+	rcConfig cfg = *tile_bake->cfg;
+	const real_t tile_world_size = cfg.tileSize * cfg.cs;
+	const real_t border_world_size = cfg.borderSize * cfg.cs;
+	cfg.bmin[0] = tile_coords.x * tile_world_size - border_world_size;
+	cfg.bmin[2] = tile_coords.y * tile_world_size - border_world_size;
+	cfg.bmax[0] = (tile_coords.x + 1) * tile_world_size + border_world_size;
+	cfg.bmax[2] = (tile_coords.y + 1) * tile_world_size + border_world_size;
+
+	// Only rasterize the triangles that overlap the tile, the full source geometry can be much larger.
+	const float *verts = tile_bake->vertices.ptr();
+	const int *indices = tile_bake->indices.ptr();
+	const int ntris = tile_bake->indices.size() / 3;
+
+	LocalVector<int> tile_tris;
+	for (int i = 0; i < ntris; i++) {
+		const float *v0 = &verts[indices[i * 3 + 0] * 3];
+		const float *v1 = &verts[indices[i * 3 + 1] * 3];
+		const float *v2 = &verts[indices[i * 3 + 2] * 3];
+		if (MAX(v0[0], MAX(v1[0], v2[0])) < cfg.bmin[0] || MIN(v0[0], MIN(v1[0], v2[0])) > cfg.bmax[0]) {
+			continue;
+		}
+		if (MAX(v0[2], MAX(v1[2], v2[2])) < cfg.bmin[2] || MIN(v0[2], MIN(v1[2], v2[2])) > cfg.bmax[2]) {
+			continue;
+		}
+		tile_tris.push_back(indices[i * 3 + 0]);
+		tile_tris.push_back(indices[i * 3 + 1]);
+		tile_tris.push_back(indices[i * 3 + 2]);
+	}
+
+	if (tile_tris.is_empty()) {
+		return;
+	}
+
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	if (!generator_build_detail_mesh(tile_bake->navigation_mesh, cfg, verts, tile_bake->vertices.size() / 3, tile_tris.ptr(), tile_tris.size() / 3, tile_bake->projected_obstructions, nullptr, &detail_mesh)) {
+		return;
+	}
+
+	generator_convert_detail_mesh(detail_mesh, tile.vertices, tile.polygons);
 
-	rcFreePolyMesh(poly_mesh);
-	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
-	detail_mesh = nullptr;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+	// Snap vertices on the tile borders to the exact same position the neighbor tile uses.
+	Vector3 *tile_vertices = tile.vertices.ptrw();
+	const real_t snap_epsilon = cfg.cs * 0.01;
+	for (int i = 0; i < tile.vertices.size(); i++) {
+		Vector3 &vertex = tile_vertices[i];
+		bool on_border = false;
+		const real_t border_x = Math::round(vertex.x / tile_world_size) * tile_world_size;
+		if (Math::abs(vertex.x - border_x) < snap_epsilon) {
+			vertex.x = border_x;
+			on_border = true;
+		}
+		const real_t border_z = Math::round(vertex.z / tile_world_size) * tile_world_size;
+		if (Math::abs(vertex.z - border_z) < snap_epsilon) {
+			vertex.z = border_z;
+			on_border = true;
+		}
+		if (on_border) {
+			vertex.y = Math::round(vertex.y / cfg.ch) * cfg.ch;
+		}
+	}
+}
+
+void NavMeshGenerator3D::generator_merge_tiles(const NavMeshTileCache3D *p_tile_cache, real_t p_tile_world_size, real_t p_max_climb, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	HashMap<Vector3, int> vertex_to_index;
+
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : p_tile_cache->tiles) {
+		const NavMeshTile3D &tile = E.value;
+
+		LocalVector<int> tile_index_to_index;
+		tile_index_to_index.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			const Vector3 &vertex = tile.vertices[i];
+			int *existing_index_ptr = vertex_to_index.getptr(vertex);
+			if (existing_index_ptr) {
+				tile_index_to_index[i] = *existing_index_ptr;
+			} else {
+				tile_index_to_index[i] = r_vertices.size();
+				vertex_to_index.insert(vertex, r_vertices.size());
+				r_vertices.push_back(vertex);
+			}
+		}
+
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			Vector<int> polygon;
+			polygon.resize(tile_polygon.size());
+			for (int i = 0; i < tile_polygon.size(); i++) {
+				polygon.write[i] = tile_index_to_index[tile_polygon[i]];
+			}
+			r_polygons.push_back(polygon);
+		}
+	}
+
+	// Neighbor tiles don't split their shared border edges at the same vertices.
+	// Insert the vertices of the other side into each border edge, so both sides
+	// share exactly the same edges and the region connects them.
+	HashMap<Vector2i, LocalVector<int>> border_vertices; // (axis, line) -> vertex indices.
+	const Vector3 *vertices = r_vertices.ptr();
+	for (int i = 0; i < r_vertices.size(); i++) {
+		const int line_x = (int)Math::round(vertices[i].x / p_tile_world_size);
+		if (vertices[i].x == line_x * p_tile_world_size) {
+			border_vertices[Vector2i(0, line_x)].push_back(i);
+		}
+		const int line_z = (int)Math::round(vertices[i].z / p_tile_world_size);
+		if (vertices[i].z == line_z * p_tile_world_size) {
+			border_vertices[Vector2i(1, line_z)].push_back(i);
+		}
+	}
+
+	struct BorderVertexSort {
+		real_t t;
+		int index;
+		bool operator<(const BorderVertexSort &p_other) const { return t < p_other.t; }
+	};
+
+	LocalVector<BorderVertexSort> edge_vertices;
+	for (Vector<int> &polygon : r_polygons) {
+		Vector<int> welded_polygon;
+		bool welded = false;
+		for (int i = 0; i < polygon.size(); i++) {
+			const int from_index = polygon[i];
+			const int to_index = polygon[(i + 1) % polygon.size()];
+			welded_polygon.push_back(from_index);
+
+			const Vector3 &from = vertices[from_index];
+			const Vector3 &to = vertices[to_index];
+			for (int axis = 0; axis < 2; axis++) {
+				const int coord = axis == 0 ? Vector3::AXIS_X : Vector3::AXIS_Z;
+				const int along = axis == 0 ? Vector3::AXIS_Z : Vector3::AXIS_X;
+				if (from[coord] != to[coord]) {
+					continue;
+				}
+				const LocalVector<int> *line_vertices = border_vertices.getptr(Vector2i(axis, (int)Math::round(from[coord] / p_tile_world_size)));
+				if (line_vertices == nullptr || from[coord] != Math::round(from[coord] / p_tile_world_size) * p_tile_world_size) {
+					continue;
+				}
+
+				const real_t edge_length = to[along] - from[along];
+				if (edge_length == 0.0) {
+					continue;
+				}
+
+				edge_vertices.clear();
+				for (int line_vertex_index : *line_vertices) {
+					const Vector3 &line_vertex = vertices[line_vertex_index];
+					const real_t t = (line_vertex[along] - from[along]) / edge_length;
+					if (t <= 0.0 || t >= 1.0) {
+						continue;
+					}
+					// Skip vertices of other floors crossing the same tile border.
+					if (Math::abs(line_vertex.y - Math::lerp(from.y, to.y, t)) > p_max_climb) {
+						continue;
+					}
+					edge_vertices.push_back({ t, line_vertex_index });
+				}
+				edge_vertices.sort();
+				for (const BorderVertexSort &edge_vertex : edge_vertices) {
+					welded_polygon.push_back(edge_vertex.index);
+					welded = true;
+				}
+				break;
+			}
+		}
+		if (welded) {
+			polygon = welded_polygon;
+		}
+	}
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
@@ -38,6 +38,8 @@
 class Node;
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
+struct rcPolyMeshDetail;
 
 class NavMeshGenerator3D : public Object {
 	GDSOFTCLASS(NavMeshGenerator3D, Object);
@@ -97,9 +99,40 @@ private:
 
 	static HashMap<Ref<NavigationMesh>, NavMeshGeneratorTask3D *> baking_navmeshes;
 
+	struct NavMeshTile3D {
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	// The baked tiles of a NavigationMesh, kept between tiled bakes so only the changed tiles need to be rebaked.
+	struct NavMeshTileCache3D {
+		uint32_t config_hash = 0;
+		HashMap<Vector2i, NavMeshTile3D> tiles;
+	};
+
+	struct NavMeshTileBake3D {
+		Ref<NavigationMesh> navigation_mesh;
+		const rcConfig *cfg = nullptr;
+		Vector<float> vertices;
+		Vector<int> indices;
+		Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+		LocalVector<Vector2i> tile_coords;
+		LocalVector<NavMeshTile3D> tiles;
+	};
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshTileCache3D *> tile_caches;
+
+	static void generator_thread_bake_tile(void *p_arg, uint32_t p_index);
+
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
+	static void generator_bake_tiles_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task, const AABB &p_changed_aabb);
+	static void generator_get_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg);
+	static bool generator_build_detail_mesh(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState *r_bake_state, rcPolyMeshDetail **r_detail_mesh);
+	static void generator_convert_detail_mesh(const rcPolyMeshDetail *p_detail_mesh, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+	static void generator_merge_tiles(const NavMeshTileCache3D *p_tile_cache, real_t p_tile_world_size, real_t p_max_climb, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -114,6 +147,7 @@ public:
 
 	static void parse_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
+	static void bake_from_source_geometry_data_tiled(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 	static String get_baking_state_msg(Ref<NavigationMesh> p_navigation_mesh);
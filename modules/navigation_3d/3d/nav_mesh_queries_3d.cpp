@@ -145,18 +145,12 @@ void NavMeshQueries3D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &r_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
 	using namespace NavigationDefaults3D;
 
-	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
+	r_query_task.start_position = p_query_parameters->get_start_position();
+	r_query_task.target_position = p_query_parameters->get_target_position();
+	r_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -164,66 +158,80 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	r_query_task.exclude_regions = _excluded_region_count > 0;
+	r_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (r_query_task.exclude_regions) {
+		r_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			r_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (r_query_task.include_regions) {
+		r_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			r_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
-	query_task.path_return_max_length = p_query_parameters->get_path_return_max_length();
-	query_task.path_return_max_radius = p_query_parameters->get_path_return_max_radius();
-	query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
-	query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
-	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+	r_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	r_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	r_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	r_query_task.path_return_max_length = p_query_parameters->get_path_return_max_length();
+	r_query_task.path_return_max_radius = p_query_parameters->get_path_return_max_radius();
+	r_query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
+	r_query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
+	r_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+}
+
+void NavMeshQueries3D::query_task_get_result(const NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result) {
+	p_query_result->set_data(
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
+	p_query_result->set_path_length(p_query_task.path_length);
+}
+
+void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_task_set_parameters(query_task, p_query_parameters);
+	query_task.callback = p_callback;
 
 	map->query_path(query_task);
 
-	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
-	p_query_result->set_path_length(query_task.path_length);
+	query_task_get_result(query_task, p_query_result);
 
 	if (query_task.callback.is_valid()) {
 		if (emit_callback(query_task.callback)) {
@@ -234,6 +242,25 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	}
 }
 
+void NavMeshQueries3D::map_query_paths(NavMap3D *map, const LocalVector<Ref<NavigationPathQueryParameters3D>> &p_query_parameters, const LocalVector<Ref<NavigationPathQueryResult3D>> &p_query_results) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.size() != p_query_results.size());
+
+	LocalVector<NavMeshPathQueryTask3D> query_tasks;
+	query_tasks.resize(p_query_parameters.size());
+	for (uint32_t i = 0; i < query_tasks.size(); i++) {
+		ERR_FAIL_COND(p_query_parameters[i].is_null());
+		ERR_FAIL_COND(p_query_results[i].is_null());
+		query_task_set_parameters(query_tasks[i], p_query_parameters[i]);
+	}
+
+	map->query_paths(query_tasks);
+
+	for (uint32_t i = 0; i < query_tasks.size(); i++) {
+		query_task_get_result(query_tasks[i], p_query_results[i]);
+	}
+}
+
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
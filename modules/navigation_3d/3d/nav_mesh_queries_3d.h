@@ -141,6 +141,10 @@ public:
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static void map_query_paths(NavMap3D *map, const LocalVector<Ref<NavigationPathQueryParameters3D>> &p_query_parameters, const LocalVector<Ref<NavigationPathQueryResult3D>> &p_query_results);
+
+	static void query_task_set_parameters(NavMeshPathQueryTask3D &r_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
+	static void query_task_get_result(const NavMeshPathQueryTask3D &p_query_task, Ref<NavigationPathQueryResult3D> p_query_result);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
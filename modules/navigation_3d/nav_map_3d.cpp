@@ -143,41 +143,103 @@ PointKey NavMap3D::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
-	if (iteration_id == 0) {
-		return;
-	}
-
-	GET_MAP_ITERATION();
+NavMeshQueries3D::PathQuerySlot *NavMap3D::_path_query_slot_acquire(NavMapIteration3D &p_map_iteration) {
+	p_map_iteration.path_query_slots_semaphore.wait();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+			path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		p_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_V_MSG(path_query_slot, nullptr, "No unused NavMap3D path query slot found! This should never happen :(.");
+	}
+
+	return path_query_slot;
+}
+
+void NavMap3D::_path_query_slot_release(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	p_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	p_map_iteration.path_query_slots_mutex.unlock();
 
+	p_map_iteration.path_query_slots_semaphore.post();
+}
+
+void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
+	if (iteration_id == 0) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	p_query_task.path_query_slot = _path_query_slot_acquire(map_iteration);
 	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+		return;
 	}
 
 	p_query_task.map_up = map_iteration.map_up;
 
 	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
+	_path_query_slot_release(map_iteration, p_query_task.path_query_slot);
 	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+}
+
+void NavMap3D::query_paths(LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &p_query_tasks) {
+	if (iteration_id == 0 || p_query_tasks.is_empty()) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	// One batch step per path query slot. Each step holds its slot for the whole batch
+	// so the A* scratch buffers are reused instead of being reacquired for every path.
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_tasks = p_query_tasks.ptr();
+	batch.query_task_count = p_query_tasks.size();
+
+	uint32_t step_count = MIN(p_query_tasks.size(), map_iteration.path_query_slots.size());
+
+	if (step_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_query_paths_batch_step, &batch, step_count, step_count, true, SNAME("NavMapPathQueries3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_query_paths_batch_step(0, &batch);
+	}
+}
+
+void NavMap3D::_query_paths_batch_step(uint32_t p_index, PathQueryBatch *p_batch) {
+	NavMapIteration3D &map_iteration = *p_batch->map_iteration;
+
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = _path_query_slot_acquire(map_iteration);
+	if (path_query_slot == nullptr) {
+		return;
+	}
+
+	// Tasks are handed out one at a time, as path costs vary too much for fixed ranges to balance.
+	uint32_t task_index = p_batch->next_query_task.postincrement();
+	while (task_index < p_batch->query_task_count) {
+		NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = p_batch->query_tasks[task_index];
+		query_task.path_query_slot = path_query_slot;
+		query_task.map_up = map_iteration.map_up;
+
+		NavMeshQueries3D::query_task_map_iteration_get_path(query_task, map_iteration);
+
+		query_task.path_query_slot = nullptr;
+		task_index = p_batch->next_query_task.postincrement();
+	}
 
-	map_iteration.path_query_slots_semaphore.post();
+	_path_query_slot_release(map_iteration, path_query_slot);
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
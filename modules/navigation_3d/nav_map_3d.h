@@ -197,6 +197,7 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void query_paths(LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &p_query_tasks);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -277,6 +278,17 @@ private:
 
 	void compute_single_step(uint32_t index, NavAgent3D **agent);
 
+	struct PathQueryBatch {
+		NavMapIteration3D *map_iteration = nullptr;
+		NavMeshQueries3D::NavMeshPathQueryTask3D *query_tasks = nullptr;
+		uint32_t query_task_count = 0;
+		SafeNumeric<uint32_t> next_query_task;
+	};
+
+	NavMeshQueries3D::PathQuerySlot *_path_query_slot_acquire(NavMapIteration3D &p_map_iteration);
+	void _path_query_slot_release(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot);
+	void _query_paths_batch_step(uint32_t p_index, PathQueryBatch *p_batch);
+
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
 
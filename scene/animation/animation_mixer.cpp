@@ -33,6 +33,8 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -989,6 +991,11 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	if (threaded_blend_queued) {
+		// A synchronous update (e.g. seeking) supersedes the pending threaded one.
+		threaded_blend_queued = false;
+		clear_animation_instances();
+	}
 	_blend_init();
 	if (cache_valid && _blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
@@ -1172,7 +1179,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendPass p_pass) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1221,6 +1228,16 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = animation_track->type;
+			if (p_pass != BLEND_PASS_ALL) {
+				bool main_thread_track = ttype == Animation::TYPE_METHOD || ttype == Animation::TYPE_AUDIO || ttype == Animation::TYPE_ANIMATION;
+				if (ttype == Animation::TYPE_VALUE) {
+					// Discrete values are set on the objects right away.
+					main_thread_track = a->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE && callback_mode_discrete != ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS;
+				}
+				if (main_thread_track != (p_pass == BLEND_PASS_MAIN_THREAD)) {
+					continue;
+				}
+			}
 			track->root_motion = root_motion_track == animation_track->path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1841,7 +1858,108 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			}
 		}
 	}
-	is_GDVIRTUAL_CALL_post_process_key_value = true;
+	if (p_pass != BLEND_PASS_EVALUATE) {
+		is_GDVIRTUAL_CALL_post_process_key_value = true;
+	}
+}
+
+/* -------------------------------------------- */
+/* -- Threaded blending ----------------------- */
+/* -------------------------------------------- */
+
+LocalVector<ObjectID> AnimationMixer::threaded_blend_queue;
+
+bool AnimationMixer::_can_blend_threaded() const {
+	if (!GLOBAL_GET_CACHED(bool, "animation/blending/use_threads")) {
+		return false;
+	}
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+#endif // TOOLS_ENABLED
+	// Mixers processed by a thread group are already off the main thread, and script callbacks can't run on worker threads.
+	return Thread::is_main_thread() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_queue_threaded_blend(double p_delta) {
+	if (threaded_blend_queued) {
+		// Processed again before the queue was flushed, keep the updates in order.
+		_flush_threaded_blends();
+	}
+
+	// Preparation may call into scripts (e.g. AnimationTree nodes), so it stays on the main thread.
+	_blend_init();
+	if (!cache_valid || !_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+
+	// _can_blend_threaded() made sure there is no script override to call.
+	is_GDVIRTUAL_CALL_post_process_key_value = false;
+	threaded_blend_delta = p_delta;
+	threaded_blend_queued = true;
+	if (threaded_blend_queue.is_empty()) {
+		callable_mp_static(&AnimationMixer::_flush_threaded_blends).call_deferred();
+	}
+	threaded_blend_queue.push_back(get_instance_id());
+}
+
+void AnimationMixer::_threaded_blend_evaluate(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_calc_total_weight();
+	mixer->_blend_process(mixer->threaded_blend_delta, false, BLEND_PASS_EVALUATE);
+}
+
+void AnimationMixer::_finish_threaded_blend() {
+	threaded_blend_queued = false;
+	_blend_process(threaded_blend_delta, false, BLEND_PASS_MAIN_THREAD);
+	clear_animation_instances();
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+}
+
+void AnimationMixer::_flush_threaded_blends() {
+	LocalVector<AnimationMixer *> mixers;
+	LocalVector<ObjectID> ids;
+	mixers.reserve(threaded_blend_queue.size());
+	ids.reserve(threaded_blend_queue.size());
+	for (const ObjectID &id : threaded_blend_queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (!mixer || !mixer->threaded_blend_queued) {
+			continue; // Freed, or superseded by a synchronous update.
+		}
+		if (!mixer->cache_valid || !mixer->is_inside_tree()) {
+			mixer->threaded_blend_queued = false;
+			mixer->clear_animation_instances();
+			continue;
+		}
+		mixers.push_back(mixer);
+		ids.push_back(id);
+	}
+	threaded_blend_queue.clear();
+	if (mixers.is_empty()) {
+		return;
+	}
+
+	// Evaluation reads the animations and only writes to each mixer's own track caches.
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_id = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_threaded_blend_evaluate, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+	} else {
+		_threaded_blend_evaluate(mixers.ptr(), 0);
+	}
+
+	// Applying the results, and firing method and audio tracks, happens in queue order for determinism.
+	for (uint32_t i = 0; i < mixers.size(); i++) {
+		// Method tracks of previous mixers may have freed this one, or updated it synchronously.
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(ids[i]);
+		if (mixer && mixer->threaded_blend_queued) {
+			mixer->_finish_threaded_blend();
+		}
+	}
 }
 
 void AnimationMixer::_blend_apply() {
@@ -2346,13 +2464,21 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				if (_can_blend_threaded()) {
+					_queue_threaded_blend(get_process_delta_time());
+				} else {
+					_process_animation(get_process_delta_time());
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				if (_can_blend_threaded()) {
+					_queue_threaded_blend(get_physics_process_delta_time());
+				} else {
+					_process_animation(get_physics_process_delta_time());
+				}
 			}
 		} break;
 
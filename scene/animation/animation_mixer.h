@@ -50,6 +50,17 @@ class AnimationMixer : public Node {
 	bool reset_on_save = true;
 	bool is_GDVIRTUAL_CALL_post_process_key_value = true;
 
+	// Mixers waiting for their tracks to be evaluated on the WorkerThreadPool, see "animation/blending/use_threads".
+	static LocalVector<ObjectID> threaded_blend_queue;
+	bool threaded_blend_queued = false;
+	double threaded_blend_delta = 0.0;
+
+	bool _can_blend_threaded() const;
+	void _queue_threaded_blend(double p_delta);
+	void _finish_threaded_blend();
+	static void _threaded_blend_evaluate(void *p_userdata, uint32_t p_index);
+	static void _flush_threaded_blends();
+
 public:
 	enum AnimationCallbackModeProcess {
 		ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS,
@@ -367,7 +378,12 @@ protected:
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map);
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For indeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	enum BlendPass {
+		BLEND_PASS_ALL,
+		BLEND_PASS_EVALUATE, // Tracks which only write to the track caches, safe to run on a worker thread.
+		BLEND_PASS_MAIN_THREAD, // Discrete value, method, audio and animation tracks.
+	};
+	void _blend_process(double p_delta, bool p_update_only = false, BlendPass p_pass = BLEND_PASS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
@@ -301,6 +301,10 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 	uint32_t mipmaps = f->get_32();
 	Image::Format format = Image::Format(f->get_32());
 
+	// When the file is readable straight from memory (e.g. a memory-mapped pack),
+	// compressed payloads are decoded in place instead of being copied out first.
+	const Span<uint8_t> mapped = f->get_mapped_span();
+
 	if (data_format == DATA_FORMAT_PNG || data_format == DATA_FORMAT_WEBP) {
 		//look for a PNG or WebP file inside
 
@@ -322,18 +326,28 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			const uint64_t pos = f->get_position();
+			if (pos + size <= mapped.size() && size <= INT32_MAX && ((data_format == DATA_FORMAT_PNG && Image::_png_mem_unpacker_func) || (data_format == DATA_FORMAT_WEBP && Image::_webp_mem_loader_func))) {
+				f->seek(pos + size);
+				if (data_format == DATA_FORMAT_PNG) {
+					img = Image::_png_mem_unpacker_func(mapped.ptr() + pos, size);
+				} else {
+					img = Image::_webp_mem_loader_func(mapped.ptr() + pos, size);
+				}
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -403,14 +417,20 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			f->seek(f->get_position() + size);
 			return Ref<Image>();
 		}
-		Vector<uint8_t> pv;
-		pv.resize(size);
-		{
-			uint8_t *wr = pv.ptrw();
-			f->get_buffer(wr, size);
-		}
 		Ref<Image> img;
-		img = Image::basis_universal_unpacker(pv);
+		const uint64_t pos = f->get_position();
+		if (pos + size <= mapped.size() && size <= INT32_MAX && Image::basis_universal_unpacker_ptr) {
+			f->seek(pos + size);
+			img = Image::basis_universal_unpacker_ptr(mapped.ptr() + pos, size);
+		} else {
+			Vector<uint8_t> pv;
+			pv.resize(size);
+			{
+				uint8_t *wr = pv.ptrw();
+				f->get_buffer(wr, size);
+			}
+			img = Image::basis_universal_unpacker(pv);
+		}
 		if (img.is_null() || img->is_empty()) {
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
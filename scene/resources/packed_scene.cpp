@@ -34,6 +34,7 @@
 #include "core/io/file_access.h"
 #include "core/io/missing_resource.h"
 #include "core/io/resource_loader.h"
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 #include "core/templates/local_vector.h"
 #include "core/variant/callable_bind.h"
@@ -150,6 +151,100 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+const SceneState::NodePlan *SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_built.is_set()) {
+		return instantiation_plan.ptr();
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_built.is_set()) {
+		return instantiation_plan.ptr();
+	}
+
+	const int nc = nodes.size();
+	const int sname_count = names.size();
+	const int prop_count = variants.size();
+
+	instantiation_plan.clear();
+	instantiation_plan.resize(nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+
+		// Only nodes created by type in this scene are planned, instances and inherited nodes may be anything.
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= sname_count) {
+			continue;
+		}
+
+		const StringName &type = names[n.type];
+		if (!ClassDB::class_exists(type)) {
+			continue;
+		}
+
+		// Extension instances can intercept Object::set() before the bound setter is reached.
+		const ClassDB::APIType api = ClassDB::get_api_type(type);
+		if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+			continue;
+		}
+
+		NodePlan &plan = instantiation_plan[i];
+		plan.type = type;
+		plan.setters.resize(n.properties.size());
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= sname_count || prop.value < 0 || prop.value >= prop_count) {
+				continue;
+			}
+
+			// Resources, arrays and dictionaries may need to be duplicated or retyped per instance.
+			const Variant::Type value_type = variants[prop.value].get_type();
+			if (value_type == Variant::OBJECT || value_type == Variant::ARRAY || value_type == Variant::DICTIONARY) {
+				continue;
+			}
+
+			int index = -1;
+			MethodBind *method = ClassDB::get_property_setter_method(type, names[prop.name], &index);
+			if (!method || method->is_vararg() || method->is_static()) {
+				continue;
+			}
+
+			const int value_arg = index >= 0 ? 1 : 0;
+			const Variant::Type arg_type = method->get_argument_type(value_arg);
+
+			PlannedSetter &setter = plan.setters[j];
+			setter.method = method;
+			setter.index = index;
+			setter.validated = !method->has_return() && method->get_argument_count() == value_arg + 1 &&
+					(index < 0 || method->get_argument_type(0) == Variant::INT) &&
+					(arg_type == value_type || arg_type == Variant::NIL);
+		}
+	}
+
+	instantiation_plan_built.set();
+	return instantiation_plan.ptr();
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan.clear();
+	instantiation_plan_built.clear();
+}
+
+void SceneState::_call_planned_setter(Node *p_node, const PlannedSetter &p_setter, const Variant &p_value) {
+	// Same call ClassDB::set_property() makes, without looking the property up again.
+	Variant index = p_setter.index;
+	const Variant *args[2] = { &index, &p_value };
+	const Variant **argptrs = p_setter.index >= 0 ? args : args + 1;
+
+	if (p_setter.validated) {
+		p_setter.method->validated_call(p_node, argptrs, nullptr);
+	} else {
+		Callable::CallError ce;
+		p_setter.method->call(p_node, argptrs, p_setter.index >= 0 ? 2 : 1, ce);
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -197,6 +292,8 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool deep_search_warned = false;
 
+	const NodePlan *plan = _get_instantiation_plan();
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -364,6 +461,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
+				// The plan holds for nodes that came out with the class it was resolved for.
+				const PlannedSetter *planned_setters = nullptr;
+				if (!missing_node && !plan[i].setters.is_empty() && node->get_class_name() == plan[i].type) {
+					planned_setters = plan[i].setters.ptr();
+				}
+#ifdef TOOLS_ENABLED
+				bool used_planned_setter = false;
+#endif
+
 				Dictionary missing_resource_properties;
 
 				for (int j = 0; j < nprop_count; j++) {
@@ -395,6 +501,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 					ERR_FAIL_INDEX_V(nprops[j].name, sname_count, nullptr);
 
+					// A script instance gets the first chance to handle the property, so it must go through Object::set().
+					if (planned_setters && planned_setters[j].method && !node->get_script_instance()) {
+						_call_planned_setter(node, planned_setters[j], props[nprops[j].value]);
+#ifdef TOOLS_ENABLED
+						used_planned_setter = true;
+#endif
+						continue;
+					}
+
 					if (snames[nprops[j].name] == CoreStringName(script)) {
 						//work around to avoid old script variables from disappearing, should be the proper fix to:
 						//https://github.com/godotengine/godot/issues/2958
@@ -499,6 +614,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				if (!missing_resource_properties.is_empty()) {
 					node->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
 				}
+#ifdef TOOLS_ENABLED
+				if (used_planned_setter) {
+					// Object::set() would have flagged the node as edited.
+					node->set_edited(true);
+				}
+#endif
 			}
 
 			//name
@@ -1433,6 +1554,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1667,6 +1789,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -2311,6 +2435,8 @@ int SceneState::add_node_path(const NodePath &p_path, const PackedInt32Array &p_
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index, int32_t p_unique_id) {
+	_clear_instantiation_plan();
+
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -2337,6 +2463,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -2349,6 +2476,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
@@ -2591,6 +2719,19 @@ HashSet<StringName> PackedScene::get_scene_groups(const String &p_path) {
 }
 #endif
 
+Ref<PackedSceneInstantiation> PackedScene::instantiate_async(int p_count) {
+	ERR_FAIL_COND_V_MSG(p_count < 1, Ref<PackedSceneInstantiation>(), "The number of instances must be at least 1.");
+	ERR_FAIL_COND_V_MSG(!can_instantiate(), Ref<PackedSceneInstantiation>(), "The PackedScene is empty and can't be instantiated.");
+
+	Ref<PackedSceneInstantiation> instantiation;
+	instantiation.instantiate();
+	instantiation->scene = Ref<PackedScene>(this);
+	instantiation->requested_count = p_count;
+	instantiation->instances.reserve(p_count);
+	instantiation->group_id = WorkerThreadPool::get_singleton()->add_native_group_task(&PackedSceneInstantiation::_instantiate_task, instantiation.ptr(), p_count, -1, false, SNAME("PackedSceneInstantiation"));
+	return instantiation;
+}
+
 Ref<SceneState> PackedScene::get_state() const {
 	return state;
 }
@@ -2611,6 +2752,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_async", "count"), &PackedScene::instantiate_async, DEFVAL(1));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -2627,3 +2769,76 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+void PackedSceneInstantiation::_instantiate_task(void *p_userdata, uint32_t p_index) {
+	PackedSceneInstantiation *self = (PackedSceneInstantiation *)p_userdata;
+
+	// Nodes outside of the tree may be built from any thread.
+	Node *node = self->scene->instantiate();
+	if (node) {
+		MutexLock lock(self->mutex);
+		self->instances.push_back(node);
+	}
+
+	// Without a message queue (e.g. headless tools), there is no main loop to emit the signal on.
+	if (self->finished_count.increment() == self->requested_count && MessageQueue::get_main_singleton()) {
+		callable_mp(self, &PackedSceneInstantiation::_emit_completed).call_deferred();
+	}
+}
+
+void PackedSceneInstantiation::_wait_for_group() {
+	if (!group_waited && group_id != -1) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+		group_waited = true;
+	}
+}
+
+void PackedSceneInstantiation::_emit_completed() {
+	emit_signal(SNAME("completed"));
+}
+
+bool PackedSceneInstantiation::is_completed() const {
+	return finished_count.get() == requested_count;
+}
+
+void PackedSceneInstantiation::wait() {
+	_wait_for_group();
+}
+
+int PackedSceneInstantiation::get_requested_count() const {
+	return requested_count;
+}
+
+int PackedSceneInstantiation::get_available_count() const {
+	MutexLock lock(mutex);
+	return instances.size();
+}
+
+Node *PackedSceneInstantiation::take_instance() {
+	MutexLock lock(mutex);
+	if (instances.is_empty()) {
+		return nullptr;
+	}
+	Node *node = instances[instances.size() - 1];
+	instances.resize(instances.size() - 1);
+	return node;
+}
+
+void PackedSceneInstantiation::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("is_completed"), &PackedSceneInstantiation::is_completed);
+	ClassDB::bind_method(D_METHOD("wait"), &PackedSceneInstantiation::wait);
+	ClassDB::bind_method(D_METHOD("get_requested_count"), &PackedSceneInstantiation::get_requested_count);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &PackedSceneInstantiation::get_available_count);
+	ClassDB::bind_method(D_METHOD("take_instance"), &PackedSceneInstantiation::take_instance);
+
+	ADD_SIGNAL(MethodInfo("completed"));
+}
+
+PackedSceneInstantiation::~PackedSceneInstantiation() {
+	_wait_for_group();
+
+	// Instances that were never taken belong to this object.
+	for (Node *node : instances) {
+		memdelete(node);
+	}
+}
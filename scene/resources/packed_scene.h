@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -105,6 +106,27 @@ class SceneState : public RefCounted {
 
 	Node *_recover_node_path_index(Node *p_base, int p_idx) const;
 
+	// Setters resolved once per scene, so that instantiating it again skips
+	// the by-name property lookup done by Object::set().
+	struct PlannedSetter {
+		MethodBind *method = nullptr; // Null if the property must go through Object::set().
+		int index = -1;
+		bool validated = false; // Value type matches the setter argument exactly.
+	};
+
+	struct NodePlan {
+		StringName type; // Class the setters were resolved for, empty if the node is not planned.
+		LocalVector<PlannedSetter> setters;
+	};
+
+	mutable LocalVector<NodePlan> instantiation_plan;
+	mutable SafeFlag instantiation_plan_built;
+	mutable Mutex instantiation_plan_mutex;
+
+	const NodePlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+	static void _call_planned_setter(Node *p_node, const PlannedSetter &p_setter, const Variant &p_value);
+
 #ifdef TOOLS_ENABLED
 public:
 	typedef void (*InstantiationWarningNotify)(const String &p_warning);
@@ -241,6 +263,8 @@ public:
 
 VARIANT_ENUM_CAST(SceneState::GenEditState)
 
+class PackedSceneInstantiation;
+
 class PackedScene : public Resource {
 	GDCLASS(PackedScene, Resource);
 	RES_BASE_EXTENSION("scn");
@@ -269,6 +293,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	Ref<PackedSceneInstantiation> instantiate_async(int p_count = 1);
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -292,3 +317,38 @@ public:
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
+
+// Instantiates a PackedScene on the WorkerThreadPool, see PackedScene::instantiate_async().
+// Instances are detached subtrees, which may be taken as soon as each one is ready.
+// Adding them to the scene tree is left to the caller, on the main thread.
+class PackedSceneInstantiation : public RefCounted {
+	GDCLASS(PackedSceneInstantiation, RefCounted);
+
+	friend class PackedScene;
+
+	Ref<PackedScene> scene;
+	uint32_t requested_count = 0;
+	WorkerThreadPool::GroupID group_id = -1;
+	bool group_waited = false;
+
+	mutable Mutex mutex;
+	LocalVector<Node *> instances;
+	SafeNumeric<uint32_t> finished_count;
+
+	static void _instantiate_task(void *p_userdata, uint32_t p_index);
+	void _wait_for_group();
+	void _emit_completed();
+
+protected:
+	static void _bind_methods();
+
+public:
+	bool is_completed() const;
+	void wait();
+
+	int get_requested_count() const;
+	int get_available_count() const;
+	Node *take_instance();
+
+	~PackedSceneInstantiation();
+};
@@ -481,6 +481,96 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(RequiredParam<PhysicsShapeQ
 	return r;
 }
 
+TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_rays(const TypedArray<PhysicsRayQueryParameters3D> &p_ray_queries) {
+	const int count = p_ray_queries.size();
+
+	LocalVector<RayParameters> parameters;
+	parameters.resize(count);
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsRayQueryParameters3D> ray_query = p_ray_queries[i];
+		ERR_FAIL_COND_V(ray_query.is_null(), TypedArray<Dictionary>());
+		parameters[i] = ray_query->get_parameters();
+	}
+
+	LocalVector<RayResult> results;
+	results.resize(count);
+	LocalVector<bool> hits;
+	hits.resize(count);
+	intersect_rays(parameters.ptr(), count, results.ptr(), hits.ptr());
+
+	TypedArray<Dictionary> ret;
+	ret.resize(count);
+	for (int i = 0; i < count; i++) {
+		Dictionary d;
+		if (hits[i]) {
+			const RayResult &result = results[i];
+			d["position"] = result.position;
+			d["normal"] = result.normal;
+			d["face_index"] = result.face_index;
+			d["collider_id"] = result.collider_id;
+			d["collider"] = result.collider;
+			d["shape"] = result.shape;
+			d["rid"] = result.rid;
+		}
+		ret[i] = d;
+	}
+	return ret;
+}
+
+TypedArray<Array> PhysicsDirectSpaceState3D::_intersect_shapes(const TypedArray<PhysicsShapeQueryParameters3D> &p_shape_queries, int p_max_results) {
+	ERR_FAIL_COND_V(p_max_results < 0, TypedArray<Array>());
+	const int count = p_shape_queries.size();
+
+	LocalVector<ShapeParameters> parameters;
+	parameters.resize(count);
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsShapeQueryParameters3D> shape_query = p_shape_queries[i];
+		ERR_FAIL_COND_V(shape_query.is_null(), TypedArray<Array>());
+		parameters[i] = shape_query->get_parameters();
+	}
+
+	LocalVector<ShapeResult> results;
+	results.resize(count * p_max_results);
+	LocalVector<int> result_counts;
+	result_counts.resize(count);
+	intersect_shapes(parameters.ptr(), count, results.ptr(), p_max_results, result_counts.ptr());
+
+	TypedArray<Array> ret;
+	ret.resize(count);
+	for (int i = 0; i < count; i++) {
+		const ShapeResult *sr = &results[i * p_max_results];
+		TypedArray<Dictionary> query_ret;
+		query_ret.resize(result_counts[i]);
+		for (int j = 0; j < result_counts[i]; j++) {
+			Dictionary d;
+			d["rid"] = sr[j].rid;
+			d["collider_id"] = sr[j].collider_id;
+			d["collider"] = sr[j].collider;
+			d["shape"] = sr[j].shape;
+			query_ret[j] = d;
+		}
+		ret[i] = query_ret;
+	}
+	return ret;
+}
+
+int PhysicsDirectSpaceState3D::intersect_rays(const RayParameters *p_parameters, int p_count, RayResult *r_results, bool *r_hits) {
+	int hit_count = 0;
+	for (int i = 0; i < p_count; i++) {
+		r_hits[i] = intersect_ray(p_parameters[i], r_results[i]);
+		if (r_hits[i]) {
+			hit_count++;
+		}
+	}
+	return hit_count;
+}
+
+void PhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters *p_parameters, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	for (int i = 0; i < p_count; i++) {
+		r_result_counts[i] = intersect_shape(p_parameters[i], r_results + i * p_result_max, p_result_max);
+	}
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -491,6 +581,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters"), &PhysicsDirectSpaceState3D::_intersect_rays);
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes, DEFVAL(32));
 }
 
 ///////////////////////////////
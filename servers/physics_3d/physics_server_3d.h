@@ -132,6 +132,8 @@ private:
 	Vector<real_t> _cast_motion(RequiredParam<PhysicsShapeQueryParameters3D> rp_shape_query);
 	TypedArray<Vector3> _collide_shape(RequiredParam<PhysicsShapeQueryParameters3D> rp_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(RequiredParam<PhysicsShapeQueryParameters3D> rp_shape_query);
+	TypedArray<Dictionary> _intersect_rays(const TypedArray<PhysicsRayQueryParameters3D> &p_ray_queries);
+	TypedArray<Array> _intersect_shapes(const TypedArray<PhysicsShapeQueryParameters3D> &p_shape_queries, int p_max_results = 32);
 
 protected:
 	static void _bind_methods();
@@ -210,6 +212,12 @@ public:
 
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
+	// Batched queries, the default implementations run them one by one.
+	// `r_results` and `r_hits` hold one entry per ray, returns the amount of rays that hit something.
+	virtual int intersect_rays(const RayParameters *p_parameters, int p_count, RayResult *r_results, bool *r_hits);
+	// `r_results` holds `p_result_max` entries per query, `r_result_counts` one per query.
+	virtual void intersect_shapes(const ShapeParameters *p_parameters, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
+
 	PhysicsDirectSpaceState3D();
 };
 
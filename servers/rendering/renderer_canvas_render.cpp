@@ -136,3 +136,31 @@ RendererCanvasRender::Item::CommandMesh::~CommandMesh() {
 		RSG::mesh_storage->mesh_instance_free(mesh_instance);
 	}
 }
+
+RendererCanvasRender::Item::CommandBlock RendererCanvasRender::command_block_alloc(bool p_small) {
+	PagedArrayPool<uint8_t> &pool = p_small ? small_command_block_pool : command_block_pool;
+	PagedArrayPool<uint8_t>::PageInfo page = pool.alloc_page();
+
+	Item::CommandBlock block;
+	block.memory = page.page;
+	block.page_id = page.page_id;
+	block.size = pool.get_page_size();
+	return block;
+}
+
+void RendererCanvasRender::command_block_free(const Item::CommandBlock &p_block) {
+	if (p_block.size == small_command_block_pool.get_page_size()) {
+		small_command_block_pool.free_page(p_block.page_id);
+	} else {
+		command_block_pool.free_page(p_block.page_id);
+	}
+}
+
+uint64_t RendererCanvasRender::get_command_memory_used() const {
+	return uint64_t(small_command_block_pool.get_pages_in_use()) * small_command_block_pool.get_page_size() + uint64_t(command_block_pool.get_pages_in_use()) * command_block_pool.get_page_size();
+}
+
+void RendererCanvasRender::end_command_frame() {
+	commands_recorded_in_frame = commands_recorded;
+	commands_recorded = 0;
+}
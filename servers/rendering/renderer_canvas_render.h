@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/templates/paged_array.h"
 #include "servers/rendering/rendering_method.h"
 #include "servers/rendering/rendering_server.h"
 
@@ -164,15 +165,20 @@ public:
 	//item
 
 	struct Item {
-		//commands are allocated in blocks of 4k to improve performance
-		//and cache coherence.
-		//blocks always grow but never shrink.
+		//commands are allocated in blocks to improve performance
+		//and cache coherence. The first block is small (most items
+		//use only a few commands), the following ones are 4k.
+		//blocks come from pools shared by all items, they always
+		//grow but never shrink, and are returned when the item is deleted.
 
 		struct CommandBlock {
 			enum {
+				SMALL_SIZE = 512,
 				MAX_SIZE = 4096
 			};
-			uint32_t usage;
+			uint32_t usage = 0;
+			uint32_t size = 0;
+			uint32_t page_id = 0;
 			uint8_t *memory = nullptr;
 		};
 
@@ -374,7 +380,7 @@ public:
 
 		Command *commands = nullptr;
 		Command *last_command = nullptr;
-		Vector<CommandBlock> blocks;
+		LocalVector<CommandBlock> blocks;
 		uint32_t current_block;
 #ifdef DEBUG_ENABLED
 		mutable double debug_redraw_time = 0;
@@ -382,70 +388,55 @@ public:
 
 		template <typename T>
 		T *alloc_command() {
+			static_assert(sizeof(T) <= CommandBlock::SMALL_SIZE, "Canvas commands must fit in the first command block.");
+
 			T *command = nullptr;
-			if (commands == nullptr) {
-				// As the most common use case of canvas items is to
-				// use only one command, the first is done with it's
-				// own allocation. The rest of them use blocks.
-				command = memnew(T);
+			while (true) {
+				if (unlikely(current_block == blocks.size())) {
+					// If we need more blocks, we take them from the shared
+					// pools (they won't be returned until this CanvasItem is
+					// deleted, though).
+					blocks.push_back(singleton->command_block_alloc(blocks.is_empty()));
+				}
+
+				CommandBlock *c = &blocks[current_block];
+				size_t space_left = c->size - c->usage;
+				if (space_left < sizeof(T)) {
+					current_block++;
+					continue;
+				}
+
+				//allocate block and add to the linked list
+				void *memory = c->memory + c->usage;
+				command = memnew_placement(memory, T);
 				command->next = nullptr;
-				commands = command;
-				last_command = command;
-			} else {
-				//Subsequent commands go into a block.
-
-				while (true) {
-					if (unlikely(current_block == (uint32_t)blocks.size())) {
-						// If we need more blocks, we allocate them
-						// (they won't be freed until this CanvasItem is
-						// deleted, though).
-						CommandBlock cb;
-						cb.memory = (uint8_t *)memalloc(CommandBlock::MAX_SIZE);
-						cb.usage = 0;
-						blocks.push_back(cb);
-					}
-
-					CommandBlock *c = &blocks.write[current_block];
-					size_t space_left = CommandBlock::MAX_SIZE - c->usage;
-					if (space_left < sizeof(T)) {
-						current_block++;
-						continue;
-					}
-
-					//allocate block and add to the linked list
-					void *memory = c->memory + c->usage;
-					command = memnew_placement(memory, T);
-					command->next = nullptr;
+				if (last_command) {
 					last_command->next = command;
-					last_command = command;
-					c->usage += sizeof(T);
-					break;
+				} else {
+					commands = command;
 				}
+				last_command = command;
+				c->usage += sizeof(T);
+				break;
 			}
 
+			singleton->commands_recorded++;
 			rect_dirty = true;
 			return command;
 		}
 
 		void clear() {
-			// The first one is always allocated on heap
-			// the rest go in the blocks
+			// All commands live in the blocks.
 			Command *c = commands;
 			while (c) {
 				Command *n = c->next;
-				if (c == commands) {
-					memdelete(commands);
-					commands = nullptr;
-				} else {
-					c->~Command();
-				}
+				c->~Command();
 				c = n;
 			}
 			{
-				uint32_t cbc = MIN((current_block + 1), (uint32_t)blocks.size());
-				CommandBlock *blockptr = blocks.ptrw();
+				uint32_t cbc = MIN((current_block + 1), blocks.size());
 				for (uint32_t i = 0; i < cbc; i++) {
-					blockptr[i].usage = 0;
+					blocks[i].usage = 0;
 				}
 			}
 
@@ -492,8 +483,8 @@ public:
 		}
 		virtual ~Item() {
 			clear();
-			for (int i = 0; i < blocks.size(); i++) {
-				memfree(blocks[i].memory);
+			for (const CommandBlock &block : blocks) {
+				singleton->command_block_free(block);
 			}
 			if (copy_back_buffer) {
 				memdelete(copy_back_buffer);
@@ -550,9 +541,24 @@ public:
 	virtual void set_debug_redraw(bool p_enabled, double p_time, const Color &p_color) = 0;
 	virtual uint32_t get_pipeline_compilations(RS::PipelineSource p_source) = 0;
 
+	// Command memory is shared by all canvas items, so redrawing or recreating
+	// items reuses blocks instead of going through the general allocator.
+	PagedArrayPool<uint8_t> small_command_block_pool;
+	PagedArrayPool<uint8_t> command_block_pool;
+	uint64_t commands_recorded = 0;
+	uint64_t commands_recorded_in_frame = 0;
+
+	Item::CommandBlock command_block_alloc(bool p_small);
+	void command_block_free(const Item::CommandBlock &p_block);
+	uint64_t get_command_memory_used() const;
+	uint64_t get_commands_recorded_in_frame() const { return commands_recorded_in_frame; }
+	void end_command_frame();
+
 	RendererCanvasRender() {
 		ERR_FAIL_COND_MSG(singleton != nullptr, "A RendererCanvasRender singleton already exists.");
 		singleton = this;
+		small_command_block_pool.configure(Item::CommandBlock::SMALL_SIZE);
+		command_block_pool.configure(Item::CommandBlock::MAX_SIZE);
 	}
 	virtual ~RendererCanvasRender() {
 		singleton = nullptr;
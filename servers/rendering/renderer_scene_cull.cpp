@@ -931,6 +931,7 @@ void RendererSceneCull::instance_set_layer_mask(RID p_instance, uint32_t p_mask)
 	instance->layer_mask = p_mask;
 	if (instance->scenario && instance->array_index >= 0) {
 		instance->scenario->instance_data[instance->array_index].layer_mask = p_mask;
+		instance->scenario->instance_cull_blocks[instance->array_index / InstanceCullBlock::SIZE].layer_mask[instance->array_index % InstanceCullBlock::SIZE] = p_mask;
 	}
 
 	if ((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK && instance->base_data) {
@@ -1157,6 +1158,7 @@ void RendererSceneCull::instance_set_ignore_culling(RID p_instance, bool p_enabl
 		} else {
 			idata.flags &= ~InstanceData::FLAG_IGNORE_ALL_CULLING;
 		}
+		instance->scenario->instance_cull_blocks[instance->array_index / InstanceCullBlock::SIZE].ignore_all_culling[instance->array_index % InstanceCullBlock::SIZE] = p_enabled;
 	}
 }
 
@@ -1838,6 +1840,16 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 
 		p_instance->scenario->instance_data.push_back(idata);
 		p_instance->scenario->instance_aabbs.push_back(InstanceBounds(p_instance->transformed_aabb));
+
+		if (p_instance->array_index % InstanceCullBlock::SIZE == 0) {
+			p_instance->scenario->instance_cull_blocks.push_back(InstanceCullBlock());
+		}
+		InstanceCullBlock &cull_block = p_instance->scenario->instance_cull_blocks[p_instance->array_index / InstanceCullBlock::SIZE];
+		uint32_t cull_lane = p_instance->array_index % InstanceCullBlock::SIZE;
+		cull_block.set_bounds(cull_lane, p_instance->scenario->instance_aabbs[p_instance->array_index]);
+		cull_block.layer_mask[cull_lane] = idata.layer_mask;
+		cull_block.ignore_all_culling[cull_lane] = p_instance->ignore_all_culling;
+
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1846,6 +1858,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
 		}
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
+		p_instance->scenario->instance_cull_blocks[p_instance->array_index / InstanceCullBlock::SIZE].set_bounds(p_instance->array_index % InstanceCullBlock::SIZE, p_instance->scenario->instance_aabbs[p_instance->array_index]);
 	}
 
 	if (p_instance->visibility_index != -1) {
@@ -1933,6 +1946,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		swapped_instance->array_index = p_instance->array_index; //swap
 		p_instance->scenario->instance_data[p_instance->array_index] = p_instance->scenario->instance_data[swap_with_index];
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = p_instance->scenario->instance_aabbs[swap_with_index];
+		p_instance->scenario->instance_cull_blocks[p_instance->array_index / InstanceCullBlock::SIZE].copy_lane(p_instance->array_index % InstanceCullBlock::SIZE, p_instance->scenario->instance_cull_blocks[swap_with_index / InstanceCullBlock::SIZE], swap_with_index % InstanceCullBlock::SIZE);
 
 		if (swapped_instance->visibility_index != -1) {
 			swapped_instance->scenario->instance_visibility[swapped_instance->visibility_index].array_index = swapped_instance->array_index;
@@ -1949,6 +1963,12 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 	// pop last
 	p_instance->scenario->instance_data.pop_back();
 	p_instance->scenario->instance_aabbs.pop_back();
+	if (swap_with_index % InstanceCullBlock::SIZE == 0) {
+		p_instance->scenario->instance_cull_blocks.resize(swap_with_index / InstanceCullBlock::SIZE);
+	} else {
+		// Keep unused lanes cleared, they are masked out by range when culling anyway.
+		p_instance->scenario->instance_cull_blocks[swap_with_index / InstanceCullBlock::SIZE].copy_lane(swap_with_index % InstanceCullBlock::SIZE, InstanceCullBlock(), 0);
+	}
 
 	//uninitialize
 	p_instance->array_index = -1;
@@ -2835,353 +2855,390 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	float z_near = cull_data.camera_matrix->get_z_near();
 	bool is_orthogonal = cull_data.camera_matrix->is_orthogonal();
 
-	for (uint64_t i = p_from; i < p_to; i++) {
-		bool mesh_visible = false;
+	uint32_t shadow_masks[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS][RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+	uint32_t sdfgi_masks[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
+
+	// Instances are tested in blocks of InstanceCullBlock::SIZE first. The bounds, layer and
+	// ignore-culling tests are done for the whole block at once, and only the instances
+	// that pass any of them go through the per-instance checks below.
+	for (uint64_t block_from = p_from; block_from < p_to;) {
+		const uint64_t block_begin = block_from - block_from % InstanceCullBlock::SIZE;
+		const uint64_t block_to = MIN(block_begin + InstanceCullBlock::SIZE, p_to);
+		const InstanceCullBlock &cull_block = cull_data.scenario->instance_cull_blocks[block_begin / InstanceCullBlock::SIZE];
+
+		const uint32_t range_mask = ((1u << (block_to - block_begin)) - 1) & ~((1u << (block_from - block_begin)) - 1);
+		const uint32_t camera_mask = cull_block.layer_mask_test(cull_data.visible_layers) & cull_block.in_frustum_mask(cull_data.cull->frustum);
+		const uint32_t ignore_all_culling_mask = cull_block.ignore_all_culling_mask();
+		uint32_t candidate_mask = camera_mask | ignore_all_culling_mask;
+
+		for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+			for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+				shadow_masks[j][k] = cull_block.in_frustum_mask(cull_data.cull->shadows[j].cascades[k].frustum);
+				candidate_mask |= shadow_masks[j][k];
+			}
+		}
+
+		for (uint32_t j = 0; j < cull_data.cull->sdfgi.region_count; j++) {
+			sdfgi_masks[j] = cull_block.in_aabb_mask(cull_data.cull->sdfgi.region_aabb[j]);
+			candidate_mask |= sdfgi_masks[j];
+		}
+
+		candidate_mask &= range_mask;
+		block_from = block_to;
+
+		for (uint32_t lane = 0; candidate_mask != 0; lane++) {
+			const uint32_t lane_bit = 1u << lane;
+			if (!(candidate_mask & lane_bit)) {
+				continue;
+			}
+			candidate_mask &= ~lane_bit;
+
+			const uint64_t i = block_begin + lane;
+			bool mesh_visible = false;
 
-		InstanceData &idata = cull_data.scenario->instance_data[i];
-		uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
-		int32_t visibility_check = -1;
+			InstanceData &idata = cull_data.scenario->instance_data[i];
+			uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
+			int32_t visibility_check = -1;
 
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
-#define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, is_orthogonal, cull_data.scenario->instance_data[i].occlusion_timeout))
 
-		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
-				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
-				if (base_type == RS::INSTANCE_LIGHT) {
-					cull_result.lights.push_back(idata.instance);
-					cull_result.light_instances.push_back(RID::from_uint64(idata.instance_data_rid));
-					if (cull_data.shadow_atlas.is_valid() && RSG::light_storage->light_has_shadow(idata.base_rid)) {
-						RSG::light_storage->light_instance_mark_visible(RID::from_uint64(idata.instance_data_rid)); //mark it visible for shadow allocation later
-					}
+			if (!HIDDEN_BY_VISIBILITY_CHECKS) {
+				if (((camera_mask & lane_bit) && VIS_CHECK && !OCCLUSION_CULLED) || (ignore_all_culling_mask & lane_bit)) {
+					uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
+					if (base_type == RS::INSTANCE_LIGHT) {
+						cull_result.lights.push_back(idata.instance);
+						cull_result.light_instances.push_back(RID::from_uint64(idata.instance_data_rid));
+						if (cull_data.shadow_atlas.is_valid() && RSG::light_storage->light_has_shadow(idata.base_rid)) {
+							RSG::light_storage->light_instance_mark_visible(RID::from_uint64(idata.instance_data_rid)); //mark it visible for shadow allocation later
+						}
 
-				} else if (base_type == RS::INSTANCE_REFLECTION_PROBE) {
-					if (cull_data.render_reflection_probe != idata.instance) {
-						//avoid entering The Matrix
+					} else if (base_type == RS::INSTANCE_REFLECTION_PROBE) {
+						if (cull_data.render_reflection_probe != idata.instance) {
+							//avoid entering The Matrix
 
-						if ((idata.flags & InstanceData::FLAG_REFLECTION_PROBE_DIRTY) || RSG::light_storage->reflection_probe_instance_needs_redraw(RID::from_uint64(idata.instance_data_rid))) {
-							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
-							cull_data.cull->lock.lock();
-							if (!reflection_probe->update_list.in_list()) {
-								reflection_probe->render_step = 0;
-								reflection_probe_render_list.add_last(&reflection_probe->update_list);
+							if ((idata.flags & InstanceData::FLAG_REFLECTION_PROBE_DIRTY) || RSG::light_storage->reflection_probe_instance_needs_redraw(RID::from_uint64(idata.instance_data_rid))) {
+								InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
+								cull_data.cull->lock.lock();
+								if (!reflection_probe->update_list.in_list()) {
+									reflection_probe->render_step = 0;
+									reflection_probe_render_list.add_last(&reflection_probe->update_list);
+								}
+								cull_data.cull->lock.unlock();
+
+								idata.flags &= ~InstanceData::FLAG_REFLECTION_PROBE_DIRTY;
 							}
-							cull_data.cull->lock.unlock();
 
-							idata.flags &= ~InstanceData::FLAG_REFLECTION_PROBE_DIRTY;
+							if (RSG::light_storage->reflection_probe_instance_has_reflection(RID::from_uint64(idata.instance_data_rid))) {
+								cull_result.reflections.push_back(RID::from_uint64(idata.instance_data_rid));
+							}
 						}
+					} else if (base_type == RS::INSTANCE_DECAL) {
+						cull_result.decals.push_back(RID::from_uint64(idata.instance_data_rid));
 
-						if (RSG::light_storage->reflection_probe_instance_has_reflection(RID::from_uint64(idata.instance_data_rid))) {
-							cull_result.reflections.push_back(RID::from_uint64(idata.instance_data_rid));
+					} else if (base_type == RS::INSTANCE_VOXEL_GI) {
+						InstanceVoxelGIData *voxel_gi = static_cast<InstanceVoxelGIData *>(idata.instance->base_data);
+						cull_data.cull->lock.lock();
+						if (!voxel_gi->update_element.in_list()) {
+							voxel_gi_update_list.add(&voxel_gi->update_element);
 						}
-					}
-				} else if (base_type == RS::INSTANCE_DECAL) {
-					cull_result.decals.push_back(RID::from_uint64(idata.instance_data_rid));
-
-				} else if (base_type == RS::INSTANCE_VOXEL_GI) {
-					InstanceVoxelGIData *voxel_gi = static_cast<InstanceVoxelGIData *>(idata.instance->base_data);
-					cull_data.cull->lock.lock();
-					if (!voxel_gi->update_element.in_list()) {
-						voxel_gi_update_list.add(&voxel_gi->update_element);
-					}
-					cull_data.cull->lock.unlock();
-					cull_result.voxel_gi_instances.push_back(RID::from_uint64(idata.instance_data_rid));
-
-				} else if (base_type == RS::INSTANCE_LIGHTMAP) {
-					cull_result.lightmaps.push_back(RID::from_uint64(idata.instance_data_rid));
-				} else if (base_type == RS::INSTANCE_FOG_VOLUME) {
-					cull_result.fog_volumes.push_back(RID::from_uint64(idata.instance_data_rid));
-				} else if (base_type == RS::INSTANCE_VISIBLITY_NOTIFIER) {
-					InstanceVisibilityNotifierData *vnd = idata.visibility_notifier;
-					if (!vnd->list_element.in_list()) {
-						visible_notifier_list_lock.lock();
-						visible_notifier_list.add(&vnd->list_element);
-						visible_notifier_list_lock.unlock();
-						vnd->just_visible = true;
-					}
-					vnd->visible_in_frame = RSG::rasterizer->get_frame_number();
-				} else if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && !(idata.flags & InstanceData::FLAG_CAST_SHADOWS_ONLY)) {
-					bool keep = true;
-
-					if (idata.flags & InstanceData::FLAG_REDRAW_IF_VISIBLE) {
-						RenderingServerDefault::redraw_request();
-					}
-
-					if (base_type == RS::INSTANCE_MESH) {
-						mesh_visible = true;
-					} else if (base_type == RS::INSTANCE_PARTICLES) {
-						//particles visible? process them
-						if (RSG::particles_storage->particles_is_inactive(idata.base_rid)) {
-							//but if nothing is going on, don't do it.
-							keep = false;
-						} else {
-							cull_data.cull->lock.lock();
-							RSG::particles_storage->particles_request_process(idata.base_rid);
-							cull_data.cull->lock.unlock();
+						cull_data.cull->lock.unlock();
+						cull_result.voxel_gi_instances.push_back(RID::from_uint64(idata.instance_data_rid));
+
+					} else if (base_type == RS::INSTANCE_LIGHTMAP) {
+						cull_result.lightmaps.push_back(RID::from_uint64(idata.instance_data_rid));
+					} else if (base_type == RS::INSTANCE_FOG_VOLUME) {
+						cull_result.fog_volumes.push_back(RID::from_uint64(idata.instance_data_rid));
+					} else if (base_type == RS::INSTANCE_VISIBLITY_NOTIFIER) {
+						InstanceVisibilityNotifierData *vnd = idata.visibility_notifier;
+						if (!vnd->list_element.in_list()) {
+							visible_notifier_list_lock.lock();
+							visible_notifier_list.add(&vnd->list_element);
+							visible_notifier_list_lock.unlock();
+							vnd->just_visible = true;
+						}
+						vnd->visible_in_frame = RSG::rasterizer->get_frame_number();
+					} else if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && !(idata.flags & InstanceData::FLAG_CAST_SHADOWS_ONLY)) {
+						bool keep = true;
 
-							RS::get_singleton()->call_on_render_thread(callable_mp_static(&RendererSceneCull::_scene_particles_set_view_axis).bind(idata.base_rid, -cull_data.cam_transform.basis.get_column(2).normalized(), cull_data.cam_transform.basis.get_column(1).normalized()));
-							//particles visible? request redraw
+						if (idata.flags & InstanceData::FLAG_REDRAW_IF_VISIBLE) {
 							RenderingServerDefault::redraw_request();
 						}
-					}
 
-					if (idata.parent_array_index != -1) {
-						float fade = 1.0f;
-						const uint32_t &parent_flags = cull_data.scenario->instance_data[idata.parent_array_index].flags;
-						if (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN) {
-							const int32_t &parent_idx = cull_data.scenario->instance_data[idata.parent_array_index].visibility_index;
-							fade = cull_data.scenario->instance_visibility[parent_idx].children_fade_alpha;
+						if (base_type == RS::INSTANCE_MESH) {
+							mesh_visible = true;
+						} else if (base_type == RS::INSTANCE_PARTICLES) {
+							//particles visible? process them
+							if (RSG::particles_storage->particles_is_inactive(idata.base_rid)) {
+								//but if nothing is going on, don't do it.
+								keep = false;
+							} else {
+								cull_data.cull->lock.lock();
+								RSG::particles_storage->particles_request_process(idata.base_rid);
+								cull_data.cull->lock.unlock();
+
+								RS::get_singleton()->call_on_render_thread(callable_mp_static(&RendererSceneCull::_scene_particles_set_view_axis).bind(idata.base_rid, -cull_data.cam_transform.basis.get_column(2).normalized(), cull_data.cam_transform.basis.get_column(1).normalized()));
+								//particles visible? request redraw
+								RenderingServerDefault::redraw_request();
+							}
 						}
-						idata.instance_geometry->set_parent_fade_alpha(fade);
-					}
 
-					if (geometry_instance_pair_mask & (1 << RS::INSTANCE_LIGHT) && (idata.flags & InstanceData::FLAG_GEOM_LIGHTING_DIRTY)) {
-						InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
-						ERR_FAIL_NULL(geom->geometry_instance);
-						// Clear any existing light instances for this mesh and find the max count per-mesh, and total (per-scene).
-						geom->geometry_instance->clear_light_instances();
-						if ((max_lights_per_mesh > 0) && (max_lights_total > 0)) {
-							// For the top N lights, track the score and the index into the internal light storage array.
-							uint32_t total_omni_count = 0, total_spot_count = 0;
-							bool omni_needs_heap = true, spot_needs_heap = true;
-							uint32_t omni_count = 0, spot_count = 0;
-							omni_score_idx.clear();
-							spot_score_idx.clear();
-							SortArray<Pair<float, uint32_t>> heapify; // SortArray has heap functions, but no local storage.
-							// Iterate over the lights (possibly > max_renderable_lights), keeping the closest to the mesh center.
-							Vector3 mesh_center = idata.instance->transformed_aabb.get_center();
-							for (const Instance *E : geom->lights) {
-								RS::LightType light_type = RSG::light_storage->light_get_type(E->base);
-								if (((RS::LIGHT_OMNI == light_type) && (total_omni_count++ < max_lights_total)) ||
-										((RS::LIGHT_SPOT == light_type) && (total_spot_count++ < max_lights_total))) {
-									// Perform culling.
-									if (!(RSG::light_storage->light_get_cull_mask(E->base) & idata.layer_mask)) {
-										continue;
-									}
-									if ((RSG::light_storage->light_get_bake_mode(E->base) == RS::LIGHT_BAKE_STATIC) && idata.instance->lightmap) {
-										continue;
-									}
+						if (idata.parent_array_index != -1) {
+							float fade = 1.0f;
+							const uint32_t &parent_flags = cull_data.scenario->instance_data[idata.parent_array_index].flags;
+							if (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN) {
+								const int32_t &parent_idx = cull_data.scenario->instance_data[idata.parent_array_index].visibility_index;
+								fade = cull_data.scenario->instance_visibility[parent_idx].children_fade_alpha;
+							}
+							idata.instance_geometry->set_parent_fade_alpha(fade);
+						}
 
-									InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
-									// Large scores are worse, so linear with distance, inverse with energy and range.
-									Vector3 light_center = E->transformed_aabb.get_center();
-									float light_range_energy =
-											RSG::light_storage->light_get_param(E->base, RS::LightParam::LIGHT_PARAM_RANGE) *
-											RSG::light_storage->light_get_param(E->base, RS::LightParam::LIGHT_PARAM_ENERGY);
-									float light_inst_score = mesh_center.distance_to(light_center) / MAX(0.01f, light_range_energy);
-									// Of the N lights (on a per-light-type basis, Omni or Spot) keep only the M "best" lights.
-									// If N <= M, we can simply store the lights, but once we exceed M, we need check each new
-									// light and see if it's score is better than the worst light stored to date.  If the new
-									// light is better, we can replace the current worst light with the new one.  In order to
-									// efficiently track our currently worst light we use a "max heap".  This loosely orders
-									// the elements in an array as a binary-tree structure, and has the properties that finding
-									// the worst score element is O(1) (it will always be stored in element [0]), and removing
-									// the old max and inserting a new value is O(log M).
+						if (geometry_instance_pair_mask & (1 << RS::INSTANCE_LIGHT) && (idata.flags & InstanceData::FLAG_GEOM_LIGHTING_DIRTY)) {
+							InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
+							ERR_FAIL_NULL(geom->geometry_instance);
+							// Clear any existing light instances for this mesh and find the max count per-mesh, and total (per-scene).
+							geom->geometry_instance->clear_light_instances();
+							if ((max_lights_per_mesh > 0) && (max_lights_total > 0)) {
+								// For the top N lights, track the score and the index into the internal light storage array.
+								uint32_t total_omni_count = 0, total_spot_count = 0;
+								bool omni_needs_heap = true, spot_needs_heap = true;
+								uint32_t omni_count = 0, spot_count = 0;
+								omni_score_idx.clear();
+								spot_score_idx.clear();
+								SortArray<Pair<float, uint32_t>> heapify; // SortArray has heap functions, but no local storage.
+								// Iterate over the lights (possibly > max_renderable_lights), keeping the closest to the mesh center.
+								Vector3 mesh_center = idata.instance->transformed_aabb.get_center();
+								for (const Instance *E : geom->lights) {
+									RS::LightType light_type = RSG::light_storage->light_get_type(E->base);
+									if (((RS::LIGHT_OMNI == light_type) && (total_omni_count++ < max_lights_total)) ||
+											((RS::LIGHT_SPOT == light_type) && (total_spot_count++ < max_lights_total))) {
+										// Perform culling.
+										if (!(RSG::light_storage->light_get_cull_mask(E->base) & idata.layer_mask)) {
+											continue;
+										}
+										if ((RSG::light_storage->light_get_bake_mode(E->base) == RS::LIGHT_BAKE_STATIC) && idata.instance->lightmap) {
+											continue;
+										}
+
+										InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
+										// Large scores are worse, so linear with distance, inverse with energy and range.
+										Vector3 light_center = E->transformed_aabb.get_center();
+										float light_range_energy =
+												RSG::light_storage->light_get_param(E->base, RS::LightParam::LIGHT_PARAM_RANGE) *
+												RSG::light_storage->light_get_param(E->base, RS::LightParam::LIGHT_PARAM_ENERGY);
+										float light_inst_score = mesh_center.distance_to(light_center) / MAX(0.01f, light_range_energy);
+										// Of the N lights (on a per-light-type basis, Omni or Spot) keep only the M "best" lights.
+										// If N <= M, we can simply store the lights, but once we exceed M, we need check each new
+										// light and see if it's score is better than the worst light stored to date.  If the new
+										// light is better, we can replace the current worst light with the new one.  In order to
+										// efficiently track our currently worst light we use a "max heap".  This loosely orders
+										// the elements in an array as a binary-tree structure, and has the properties that finding
+										// the worst score element is O(1) (it will always be stored in element [0]), and removing
+										// the old max and inserting a new value is O(log M).
 #define VERIFY_RELEVANT_LIGHT_HEAP 0
 #if VERIFY_RELEVANT_LIGHT_HEAP
-									WARN_PRINT_ONCE("VERIFY_RELEVANT_LIGHT_HEAP is True");
+										WARN_PRINT_ONCE("VERIFY_RELEVANT_LIGHT_HEAP is True");
 #endif
-									switch (light_type) {
-										case RS::LIGHT_OMNI: {
-											if (omni_count < max_lights_per_mesh) {
-												// We have room to just add it, and track the score and where it goes.
-												omni_score_idx.push_back(Pair(light_inst_score, omni_count));
-												geom->geometry_instance->pair_light_instance(light->instance, light_type, omni_count++);
-											} else {
-												if (omni_needs_heap) {
-													// We need to make this a heap one time.
-													heapify.make_heap(0, omni_count, &omni_score_idx[0]);
-													omni_needs_heap = false;
-												}
-												if (light_inst_score < omni_score_idx[0].first) {
+										switch (light_type) {
+											case RS::LIGHT_OMNI: {
+												if (omni_count < max_lights_per_mesh) {
+													// We have room to just add it, and track the score and where it goes.
+													omni_score_idx.push_back(Pair(light_inst_score, omni_count));
+													geom->geometry_instance->pair_light_instance(light->instance, light_type, omni_count++);
+												} else {
+													if (omni_needs_heap) {
+														// We need to make this a heap one time.
+														heapify.make_heap(0, omni_count, &omni_score_idx[0]);
+														omni_needs_heap = false;
+													}
+													if (light_inst_score < omni_score_idx[0].first) {
 #if VERIFY_RELEVANT_LIGHT_HEAP
-													// The [0] element should have the max score.
-													for (uint32_t vi = 1; vi < max_lights_per_mesh; ++vi) {
-														if (omni_score_idx[vi].first > omni_score_idx[0].first) {
-															ERR_PRINT_ONCE("Relevant Omni Light Heap Error");
+														// The [0] element should have the max score.
+														for (uint32_t vi = 1; vi < max_lights_per_mesh; ++vi) {
+															if (omni_score_idx[vi].first > omni_score_idx[0].first) {
+																ERR_PRINT_ONCE("Relevant Omni Light Heap Error");
+															}
 														}
-													}
 #endif
-													uint32_t replace_index = omni_score_idx[0].second;
-													geom->geometry_instance->pair_light_instance(light->instance, light_type, replace_index);
-													heapify.adjust_heap(0, 0, omni_count, Pair(light_inst_score, replace_index), &omni_score_idx[0]);
-												}
-											}
-										} break;
-										case RS::LIGHT_SPOT: {
-											if (spot_count < max_lights_per_mesh) {
-												// We have room to just add it, and track the score and where it goes.
-												spot_score_idx.push_back(Pair(light_inst_score, spot_count));
-												geom->geometry_instance->pair_light_instance(light->instance, light_type, spot_count++);
-											} else {
-												if (spot_needs_heap) {
-													// We need to make this a heap one time.
-													heapify.make_heap(0, spot_count, &spot_score_idx[0]);
-													spot_needs_heap = false;
+														uint32_t replace_index = omni_score_idx[0].second;
+														geom->geometry_instance->pair_light_instance(light->instance, light_type, replace_index);
+														heapify.adjust_heap(0, 0, omni_count, Pair(light_inst_score, replace_index), &omni_score_idx[0]);
+													}
 												}
-												if (light_inst_score < spot_score_idx[0].first) {
+											} break;
+											case RS::LIGHT_SPOT: {
+												if (spot_count < max_lights_per_mesh) {
+													// We have room to just add it, and track the score and where it goes.
+													spot_score_idx.push_back(Pair(light_inst_score, spot_count));
+													geom->geometry_instance->pair_light_instance(light->instance, light_type, spot_count++);
+												} else {
+													if (spot_needs_heap) {
+														// We need to make this a heap one time.
+														heapify.make_heap(0, spot_count, &spot_score_idx[0]);
+														spot_needs_heap = false;
+													}
+													if (light_inst_score < spot_score_idx[0].first) {
 #if VERIFY_RELEVANT_LIGHT_HEAP
-													// The [0] element should have the max score.
-													for (uint32_t vi = 1; vi < max_lights_per_mesh; ++vi) {
-														if (spot_score_idx[vi].first > spot_score_idx[0].first) {
-															ERR_PRINT_ONCE("Relevant Spot Light Heap Error");
+														// The [0] element should have the max score.
+														for (uint32_t vi = 1; vi < max_lights_per_mesh; ++vi) {
+															if (spot_score_idx[vi].first > spot_score_idx[0].first) {
+																ERR_PRINT_ONCE("Relevant Spot Light Heap Error");
+															}
 														}
-													}
 #endif
-													uint32_t replace_index = spot_score_idx[0].second;
-													geom->geometry_instance->pair_light_instance(light->instance, light_type, replace_index);
-													heapify.adjust_heap(0, 0, spot_count, Pair(light_inst_score, replace_index), &spot_score_idx[0]);
+														uint32_t replace_index = spot_score_idx[0].second;
+														geom->geometry_instance->pair_light_instance(light->instance, light_type, replace_index);
+														heapify.adjust_heap(0, 0, spot_count, Pair(light_inst_score, replace_index), &spot_score_idx[0]);
+													}
 												}
-											}
-										} break;
-										default:
-											break;
+											} break;
+											default:
+												break;
+										}
 									}
 								}
 							}
+							idata.flags &= ~InstanceData::FLAG_GEOM_LIGHTING_DIRTY;
 						}
-						idata.flags &= ~InstanceData::FLAG_GEOM_LIGHTING_DIRTY;
-					}
 
-					if (idata.flags & InstanceData::FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY) {
-						InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
+						if (idata.flags & InstanceData::FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY) {
+							InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
 
-						ERR_FAIL_NULL(geom->geometry_instance);
-						cull_data.cull->lock.lock();
-						geom->geometry_instance->set_softshadow_projector_pairing(geom->softshadow_count > 0, geom->projector_count > 0);
-						cull_data.cull->lock.unlock();
-						idata.flags &= ~InstanceData::FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY;
-					}
+							ERR_FAIL_NULL(geom->geometry_instance);
+							cull_data.cull->lock.lock();
+							geom->geometry_instance->set_softshadow_projector_pairing(geom->softshadow_count > 0, geom->projector_count > 0);
+							cull_data.cull->lock.unlock();
+							idata.flags &= ~InstanceData::FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY;
+						}
 
-					if (geometry_instance_pair_mask & (1 << RS::INSTANCE_REFLECTION_PROBE) && (idata.flags & InstanceData::FLAG_GEOM_REFLECTION_DIRTY)) {
-						InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
-						uint32_t idx = 0;
+						if (geometry_instance_pair_mask & (1 << RS::INSTANCE_REFLECTION_PROBE) && (idata.flags & InstanceData::FLAG_GEOM_REFLECTION_DIRTY)) {
+							InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
+							uint32_t idx = 0;
 
-						for (const Instance *E : geom->reflection_probes) {
-							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(E->base_data);
+							for (const Instance *E : geom->reflection_probes) {
+								InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(E->base_data);
 
-							instance_pair_buffer[idx++] = reflection_probe->instance;
-							if (idx == MAX_INSTANCE_PAIRS) {
-								break;
+								instance_pair_buffer[idx++] = reflection_probe->instance;
+								if (idx == MAX_INSTANCE_PAIRS) {
+									break;
+								}
 							}
-						}
 
-						ERR_FAIL_NULL(geom->geometry_instance);
-						geom->geometry_instance->pair_reflection_probe_instances(instance_pair_buffer, idx);
-						idata.flags &= ~InstanceData::FLAG_GEOM_REFLECTION_DIRTY;
-					}
+							ERR_FAIL_NULL(geom->geometry_instance);
+							geom->geometry_instance->pair_reflection_probe_instances(instance_pair_buffer, idx);
+							idata.flags &= ~InstanceData::FLAG_GEOM_REFLECTION_DIRTY;
+						}
 
-					if (geometry_instance_pair_mask & (1 << RS::INSTANCE_DECAL) && (idata.flags & InstanceData::FLAG_GEOM_DECAL_DIRTY)) {
-						InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
-						uint32_t idx = 0;
+						if (geometry_instance_pair_mask & (1 << RS::INSTANCE_DECAL) && (idata.flags & InstanceData::FLAG_GEOM_DECAL_DIRTY)) {
+							InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
+							uint32_t idx = 0;
 
-						for (const Instance *E : geom->decals) {
-							InstanceDecalData *decal = static_cast<InstanceDecalData *>(E->base_data);
+							for (const Instance *E : geom->decals) {
+								InstanceDecalData *decal = static_cast<InstanceDecalData *>(E->base_data);
 
-							instance_pair_buffer[idx++] = decal->instance;
-							if (idx == MAX_INSTANCE_PAIRS) {
-								break;
+								instance_pair_buffer[idx++] = decal->instance;
+								if (idx == MAX_INSTANCE_PAIRS) {
+									break;
+								}
 							}
-						}
 
-						ERR_FAIL_NULL(geom->geometry_instance);
-						geom->geometry_instance->pair_decal_instances(instance_pair_buffer, idx);
+							ERR_FAIL_NULL(geom->geometry_instance);
+							geom->geometry_instance->pair_decal_instances(instance_pair_buffer, idx);
 
-						idata.flags &= ~InstanceData::FLAG_GEOM_DECAL_DIRTY;
-					}
+							idata.flags &= ~InstanceData::FLAG_GEOM_DECAL_DIRTY;
+						}
 
-					if (idata.flags & InstanceData::FLAG_GEOM_VOXEL_GI_DIRTY) {
-						InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
-						uint32_t idx = 0;
-						for (const Instance *E : geom->voxel_gi_instances) {
-							InstanceVoxelGIData *voxel_gi = static_cast<InstanceVoxelGIData *>(E->base_data);
+						if (idata.flags & InstanceData::FLAG_GEOM_VOXEL_GI_DIRTY) {
+							InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
+							uint32_t idx = 0;
+							for (const Instance *E : geom->voxel_gi_instances) {
+								InstanceVoxelGIData *voxel_gi = static_cast<InstanceVoxelGIData *>(E->base_data);
 
-							instance_pair_buffer[idx++] = voxel_gi->probe_instance;
-							if (idx == MAX_INSTANCE_PAIRS) {
-								break;
+								instance_pair_buffer[idx++] = voxel_gi->probe_instance;
+								if (idx == MAX_INSTANCE_PAIRS) {
+									break;
+								}
 							}
-						}
 
-						ERR_FAIL_NULL(geom->geometry_instance);
-						geom->geometry_instance->pair_voxel_gi_instances(instance_pair_buffer, idx);
+							ERR_FAIL_NULL(geom->geometry_instance);
+							geom->geometry_instance->pair_voxel_gi_instances(instance_pair_buffer, idx);
 
-						idata.flags &= ~InstanceData::FLAG_GEOM_VOXEL_GI_DIRTY;
-					}
+							idata.flags &= ~InstanceData::FLAG_GEOM_VOXEL_GI_DIRTY;
+						}
 
-					if ((idata.flags & InstanceData::FLAG_LIGHTMAP_CAPTURE) && idata.instance->last_frame_pass != frame_number && !idata.instance->lightmap_target_sh.is_empty() && !idata.instance->lightmap_sh.is_empty()) {
-						InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
-						Color *sh = idata.instance->lightmap_sh.ptrw();
-						const Color *target_sh = idata.instance->lightmap_target_sh.ptr();
-						for (uint32_t j = 0; j < 9; j++) {
-							sh[j] = sh[j].lerp(target_sh[j], MIN(1.0, lightmap_probe_update_speed));
+						if ((idata.flags & InstanceData::FLAG_LIGHTMAP_CAPTURE) && idata.instance->last_frame_pass != frame_number && !idata.instance->lightmap_target_sh.is_empty() && !idata.instance->lightmap_sh.is_empty()) {
+							InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(idata.instance->base_data);
+							Color *sh = idata.instance->lightmap_sh.ptrw();
+							const Color *target_sh = idata.instance->lightmap_target_sh.ptr();
+							for (uint32_t j = 0; j < 9; j++) {
+								sh[j] = sh[j].lerp(target_sh[j], MIN(1.0, lightmap_probe_update_speed));
+							}
+							ERR_FAIL_NULL(geom->geometry_instance);
+							cull_data.cull->lock.lock();
+							geom->geometry_instance->set_lightmap_capture(sh);
+							cull_data.cull->lock.unlock();
+							idata.instance->last_frame_pass = frame_number;
 						}
-						ERR_FAIL_NULL(geom->geometry_instance);
-						cull_data.cull->lock.lock();
-						geom->geometry_instance->set_lightmap_capture(sh);
-						cull_data.cull->lock.unlock();
-						idata.instance->last_frame_pass = frame_number;
-					}
 
-					if (keep) {
-						cull_result.geometry_instances.push_back(idata.instance_geometry);
+						if (keep) {
+							cull_result.geometry_instances.push_back(idata.instance_geometry);
+						}
 					}
 				}
-			}
 
-			for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
-				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (!light_culler->cull_directional_light(cull_data.scenario->instance_aabbs[i], j, k)) { // pass the cascade index
-						continue;
-					}
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
-						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
+				for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+					for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+						if (!light_culler->cull_directional_light(cull_data.scenario->instance_aabbs[i], j, k)) { // pass the cascade index
+							continue;
+						}
+						if ((shadow_masks[j][k] & lane_bit) && VIS_CHECK) {
+							uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
-						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && (LAYER_CHECK & cull_data.cull->shadows[j].caster_mask)) {
-							cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
-							mesh_visible = true;
+							if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && (LAYER_CHECK & cull_data.cull->shadows[j].caster_mask)) {
+								cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
+								mesh_visible = true;
+							}
 						}
 					}
 				}
 			}
-		}
 
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
-#undef IN_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
 #undef OCCLUSION_CULLED
 
-		for (uint32_t j = 0; j < cull_data.cull->sdfgi.region_count; j++) {
-			if (cull_data.scenario->instance_aabbs[i].in_aabb(cull_data.cull->sdfgi.region_aabb[j])) {
-				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
-
-				if (base_type == RS::INSTANCE_LIGHT) {
-					InstanceLightData *instance_light = (InstanceLightData *)idata.instance->base_data;
-					if (instance_light->bake_mode == RS::LIGHT_BAKE_STATIC && cull_data.cull->sdfgi.region_cascade[j] <= instance_light->max_sdfgi_cascade) {
-						if (sdfgi_last_light_index != i || sdfgi_last_light_cascade != cull_data.cull->sdfgi.region_cascade[j]) {
-							sdfgi_last_light_index = i;
-							sdfgi_last_light_cascade = cull_data.cull->sdfgi.region_cascade[j];
-							cull_result.sdfgi_cascade_lights[sdfgi_last_light_cascade].push_back(instance_light->instance);
+			for (uint32_t j = 0; j < cull_data.cull->sdfgi.region_count; j++) {
+				if (sdfgi_masks[j] & lane_bit) {
+					uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
+
+					if (base_type == RS::INSTANCE_LIGHT) {
+						InstanceLightData *instance_light = (InstanceLightData *)idata.instance->base_data;
+						if (instance_light->bake_mode == RS::LIGHT_BAKE_STATIC && cull_data.cull->sdfgi.region_cascade[j] <= instance_light->max_sdfgi_cascade) {
+							if (sdfgi_last_light_index != i || sdfgi_last_light_cascade != cull_data.cull->sdfgi.region_cascade[j]) {
+								sdfgi_last_light_index = i;
+								sdfgi_last_light_cascade = cull_data.cull->sdfgi.region_cascade[j];
+								cull_result.sdfgi_cascade_lights[sdfgi_last_light_cascade].push_back(instance_light->instance);
+							}
+						}
+					} else if ((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) {
+						if (idata.flags & InstanceData::FLAG_USES_BAKED_LIGHT) {
+							cull_result.sdfgi_region_geometry_instances[j].push_back(idata.instance_geometry);
+							mesh_visible = true;
 						}
-					}
-				} else if ((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) {
-					if (idata.flags & InstanceData::FLAG_USES_BAKED_LIGHT) {
-						cull_result.sdfgi_region_geometry_instances[j].push_back(idata.instance_geometry);
-						mesh_visible = true;
 					}
 				}
 			}
-		}
 
-		if (mesh_visible && cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_USES_MESH_INSTANCE) {
-			cull_result.mesh_instances.push_back(cull_data.scenario->instance_data[i].instance->mesh_instance);
+			if (mesh_visible && cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_USES_MESH_INSTANCE) {
+				cull_result.mesh_instances.push_back(cull_data.scenario->instance_data[i].instance->mesh_instance);
+			}
 		}
 	}
 }
@@ -4267,6 +4324,7 @@ bool RendererSceneCull::free(RID p_rid) {
 		}
 		scenario->instance_aabbs.reset();
 		scenario->instance_data.reset();
+		scenario->instance_cull_blocks.reset();
 		scenario->instance_visibility.reset();
 
 		RSG::light_storage->shadow_atlas_free(scenario->reflection_probe_shadow_atlas);
@@ -250,6 +250,91 @@ public:
 		}
 	};
 
+	struct InstanceCullBlock {
+		// The bounds and masks of 8 consecutive instances, split per component,
+		// so the first culling tests run on all of them at once.
+		enum {
+			SIZE = 8,
+		};
+
+		real_t bounds[6][SIZE]; // Same component order as InstanceBounds.
+		uint32_t layer_mask[SIZE];
+		uint32_t ignore_all_culling[SIZE];
+
+		_ALWAYS_INLINE_ InstanceCullBlock() {
+			memset(this, 0, sizeof(InstanceCullBlock));
+		}
+
+		_ALWAYS_INLINE_ void set_bounds(uint32_t p_lane, const InstanceBounds &p_bounds) {
+			for (uint32_t i = 0; i < 6; i++) {
+				bounds[i][p_lane] = p_bounds.bounds[i];
+			}
+		}
+		_ALWAYS_INLINE_ void copy_lane(uint32_t p_lane, const InstanceCullBlock &p_from, uint32_t p_from_lane) {
+			for (uint32_t i = 0; i < 6; i++) {
+				bounds[i][p_lane] = p_from.bounds[i][p_from_lane];
+			}
+			layer_mask[p_lane] = p_from.layer_mask[p_from_lane];
+			ignore_all_culling[p_lane] = p_from.ignore_all_culling[p_from_lane];
+		}
+
+		// The loops below are kept branchless over the lanes so they auto-vectorize.
+		_ALWAYS_INLINE_ uint32_t in_frustum_mask(const Frustum &p_frustum) const {
+			uint32_t inside[SIZE];
+			for (uint32_t j = 0; j < SIZE; j++) {
+				inside[j] = 1;
+			}
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &plane = p_frustum.planes_ptr[i];
+				const real_t *xs = bounds[p_frustum.plane_signs_ptr[i].signs[0]];
+				const real_t *ys = bounds[p_frustum.plane_signs_ptr[i].signs[1]];
+				const real_t *zs = bounds[p_frustum.plane_signs_ptr[i].signs[2]];
+				for (uint32_t j = 0; j < SIZE; j++) {
+					inside[j] &= (plane.normal.x * xs[j] + plane.normal.y * ys[j] + plane.normal.z * zs[j] - plane.d) < 0.0;
+				}
+			}
+
+			return _pack_mask(inside);
+		}
+		_ALWAYS_INLINE_ uint32_t in_aabb_mask(const AABB &p_aabb) const {
+			const Vector3 end = p_aabb.position + p_aabb.size;
+
+			uint32_t inside[SIZE];
+			for (uint32_t j = 0; j < SIZE; j++) {
+				inside[j] = (bounds[0][j] < end.x) & (bounds[3][j] > p_aabb.position.x) &
+						(bounds[1][j] < end.y) & (bounds[4][j] > p_aabb.position.y) &
+						(bounds[2][j] < end.z) & (bounds[5][j] > p_aabb.position.z);
+			}
+
+			return _pack_mask(inside);
+		}
+		_ALWAYS_INLINE_ uint32_t layer_mask_test(uint32_t p_layers) const {
+			uint32_t visible[SIZE];
+			for (uint32_t j = 0; j < SIZE; j++) {
+				visible[j] = (layer_mask[j] & p_layers) != 0;
+			}
+
+			return _pack_mask(visible);
+		}
+		_ALWAYS_INLINE_ uint32_t ignore_all_culling_mask() const {
+			uint32_t ignore[SIZE];
+			for (uint32_t j = 0; j < SIZE; j++) {
+				ignore[j] = ignore_all_culling[j] != 0;
+			}
+
+			return _pack_mask(ignore);
+		}
+
+		static _ALWAYS_INLINE_ uint32_t _pack_mask(const uint32_t *p_lanes) {
+			uint32_t mask = 0;
+			for (uint32_t j = 0; j < SIZE; j++) {
+				mask |= p_lanes[j] << j;
+			}
+			return mask;
+		}
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -350,6 +435,8 @@ public:
 
 		PagedArray<InstanceBounds> instance_aabbs;
 		PagedArray<InstanceData> instance_data;
+		// Mirrors instance_aabbs and the culling relevant parts of instance_data, see InstanceCullBlock.
+		LocalVector<InstanceCullBlock> instance_cull_blocks;
 		VisibilityArray instance_visibility;
 
 		Scenario() {
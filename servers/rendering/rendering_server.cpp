@@ -3596,6 +3596,8 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_COMMAND_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_COMMANDS_IN_FRAME);
 
 	BIND_ENUM_CONSTANT(PIPELINE_SOURCE_CANVAS);
 	BIND_ENUM_CONSTANT(PIPELINE_SOURCE_MESH);
@@ -1833,6 +1833,8 @@ public:
 		RENDERING_INFO_PIPELINE_COMPILATIONS_SURFACE,
 		RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW,
 		RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION,
+		RENDERING_INFO_CANVAS_COMMAND_MEM_USED,
+		RENDERING_INFO_CANVAS_COMMANDS_IN_FRAME,
 		RENDERING_INFO_MAX
 	};
 
@@ -104,6 +104,7 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	GodotProfileZoneGrouped(_profile_zone, "canvas_render->update");
 	RSG::canvas_render->update();
+	RSG::canvas_render->end_command_frame();
 
 	GodotProfileZoneGrouped(_profile_zone, "rasterizer->end_frame");
 	RSG::rasterizer->end_frame(p_swap_buffers);
@@ -315,6 +316,10 @@ uint64_t RenderingServerDefault::get_rendering_info(RenderingInfo p_info) {
 		return RSG::canvas_render->get_pipeline_compilations(PIPELINE_SOURCE_DRAW) + RSG::scene->get_pipeline_compilations(PIPELINE_SOURCE_DRAW);
 	} else if (p_info == RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION) {
 		return RSG::canvas_render->get_pipeline_compilations(PIPELINE_SOURCE_SPECIALIZATION) + RSG::scene->get_pipeline_compilations(PIPELINE_SOURCE_SPECIALIZATION);
+	} else if (p_info == RENDERING_INFO_CANVAS_COMMAND_MEM_USED) {
+		return RSG::canvas_render->get_command_memory_used();
+	} else if (p_info == RENDERING_INFO_CANVAS_COMMANDS_IN_FRAME) {
+		return RSG::canvas_render->get_commands_recorded_in_frame();
 	}
 	return RSG::utilities->get_rendering_info(p_info);
 }
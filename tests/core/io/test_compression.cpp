@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*  test_compression.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_compression)
+
+#include "core/io/compression.h"
+#include "core/math/random_number_generator.h"
+
+namespace TestCompression {
+
+static Vector<uint8_t> _make_payload(int p_size, uint64_t p_seed) {
+	// Repetitive text with some noise, so that it compresses but not trivially.
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(p_seed);
+	const String words[] = { "position", "rotation", "velocity", "health", "ammo", "player", "enemy", "score" };
+	Vector<uint8_t> payload;
+	while (payload.size() < p_size) {
+		const String word = vformat("%s=%d;", words[rng->randi_range(0, 7)], rng->randi_range(0, 999));
+		payload.append_array(word.to_ascii_buffer());
+	}
+	payload.resize(p_size);
+	return payload;
+}
+
+// Runs the whole input through the stream in small chunks, with a small output buffer.
+static Error _run_stream(CompressionStream &p_stream, const Vector<uint8_t> &p_input, Vector<uint8_t> &r_output, int p_chunk_size) {
+	r_output.clear();
+	Vector<uint8_t> out_chunk;
+	out_chunk.resize(p_chunk_size);
+
+	int64_t offset = 0;
+	while (true) {
+		const int64_t to_read = MIN(p_chunk_size, p_input.size() - offset);
+		const bool finish = p_stream.is_compressing() && offset + to_read == p_input.size();
+		int64_t consumed = 0;
+		int64_t written = 0;
+		Error err = p_stream.process(p_input.ptr() + offset, to_read, consumed, out_chunk.ptrw(), out_chunk.size(), written, finish);
+		if (err != OK) {
+			return err;
+		}
+		offset += consumed;
+		r_output.append_array(out_chunk.slice(0, written));
+		if (p_stream.is_finished()) {
+			return OK;
+		}
+		if (consumed == 0 && written == 0 && offset == p_input.size()) {
+			// No progress possible, the input ended before the stream did.
+			return ERR_FILE_EOF;
+		}
+	}
+}
+
+TEST_CASE("[Compression] Streaming compression round trip") {
+	const Vector<uint8_t> payload = _make_payload(300000, 42);
+
+	Compression::Mode mode = Compression::MODE_ZSTD;
+	SUBCASE("Zstandard") {
+		mode = Compression::MODE_ZSTD;
+	}
+	SUBCASE("Deflate") {
+		mode = Compression::MODE_DEFLATE;
+	}
+	SUBCASE("GZip") {
+		mode = Compression::MODE_GZIP;
+	}
+
+	CompressionStream compressor;
+	REQUIRE(compressor.start_compression(mode) == OK);
+	Vector<uint8_t> compressed;
+	CHECK(_run_stream(compressor, payload, compressed, 1000) == OK);
+	CHECK(compressed.size() < payload.size());
+
+	// The streamed data must be readable by the one-shot API...
+	Vector<uint8_t> decompressed;
+	decompressed.resize(payload.size());
+	CHECK(Compression::decompress(decompressed.ptrw(), decompressed.size(), compressed.ptr(), compressed.size(), mode) == payload.size());
+	CHECK(decompressed == payload);
+
+	// ...and by the streaming API, with small buffers on both ends.
+	CompressionStream decompressor;
+	REQUIRE(decompressor.start_decompression(mode) == OK);
+	CHECK(_run_stream(decompressor, compressed, decompressed, 777) == OK);
+	CHECK(decompressed == payload);
+
+	// Reusing a stream after reset() produces the same result.
+	REQUIRE(compressor.reset() == OK);
+	Vector<uint8_t> compressed_again;
+	CHECK(_run_stream(compressor, payload, compressed_again, 4096) == OK);
+	REQUIRE(decompressor.reset() == OK);
+	CHECK(_run_stream(decompressor, compressed_again, decompressed, 4096) == OK);
+	CHECK(decompressed == payload);
+}
+
+TEST_CASE("[Compression] Streaming decompression errors") {
+	const Vector<uint8_t> payload = _make_payload(10000, 7);
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(payload.size(), Compression::MODE_ZSTD));
+	compressed.resize(Compression::compress(compressed.ptrw(), payload.ptr(), payload.size(), Compression::MODE_ZSTD));
+
+	CompressionStream decompressor;
+	Vector<uint8_t> decompressed;
+
+	// Truncated input doesn't finish the stream.
+	REQUIRE(decompressor.start_decompression(Compression::MODE_ZSTD) == OK);
+	CHECK(_run_stream(decompressor, compressed.slice(0, compressed.size() / 2), decompressed, 512) == ERR_FILE_EOF);
+	CHECK_FALSE(decompressor.is_finished());
+
+	// Corrupted input is reported as such.
+	Vector<uint8_t> corrupted = compressed;
+	for (int i = 0; i < 8; i++) {
+		corrupted.write[i] ^= 0x5A;
+	}
+	REQUIRE(decompressor.reset() == OK);
+	ERR_PRINT_OFF
+	CHECK(_run_stream(decompressor, corrupted, decompressed, 512) == ERR_FILE_CORRUPT);
+
+	// Unsupported configurations are rejected.
+	CompressionStream stream;
+	CHECK(stream.start_compression(Compression::MODE_FASTLZ) == ERR_UNAVAILABLE);
+	CHECK(stream.start_compression(Compression::MODE_BROTLI) == ERR_UNAVAILABLE);
+	CHECK(stream.start_compression(Compression::MODE_DEFLATE, payload) == ERR_INVALID_PARAMETER);
+	CHECK_FALSE(stream.is_active());
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[Compression] Zstandard dictionaries for small payloads") {
+	Vector<Vector<uint8_t>> samples;
+	for (int i = 0; i < 100; i++) {
+		samples.push_back(_make_payload(300, i));
+	}
+	const Vector<uint8_t> dictionary = Compression::create_zstd_raw_dictionary(samples, 16384);
+	CHECK(dictionary.size() <= 16384);
+	CHECK(dictionary.size() > 16384 - 300);
+
+	CompressionStream plain_compressor;
+	CompressionStream dictionary_compressor;
+	CompressionStream dictionary_decompressor;
+	REQUIRE(plain_compressor.start_compression(Compression::MODE_ZSTD) == OK);
+	REQUIRE(dictionary_compressor.start_compression(Compression::MODE_ZSTD, dictionary) == OK);
+	REQUIRE(dictionary_decompressor.start_decompression(Compression::MODE_ZSTD, dictionary) == OK);
+
+	int64_t plain_total = 0;
+	int64_t dictionary_total = 0;
+	for (int i = 0; i < 20; i++) {
+		const Vector<uint8_t> payload = _make_payload(300, 1000 + i);
+		Vector<uint8_t> plain;
+		Vector<uint8_t> compressed;
+		Vector<uint8_t> decompressed;
+
+		REQUIRE(plain_compressor.reset() == OK);
+		REQUIRE(dictionary_compressor.reset() == OK);
+		REQUIRE(dictionary_decompressor.reset() == OK);
+		CHECK(_run_stream(plain_compressor, payload, plain, 1024) == OK);
+		CHECK(_run_stream(dictionary_compressor, payload, compressed, 1024) == OK);
+		CHECK(_run_stream(dictionary_decompressor, compressed, decompressed, 1024) == OK);
+		CHECK(decompressed == payload);
+
+		plain_total += plain.size();
+		dictionary_total += compressed.size();
+	}
+	CHECK_MESSAGE(dictionary_total < plain_total, "Compressing small payloads with a dictionary should produce smaller output.");
+
+	// Data compressed with a dictionary can't be decompressed without it.
+	const Vector<uint8_t> payload = _make_payload(300, 5000);
+	Vector<uint8_t> compressed;
+	Vector<uint8_t> decompressed;
+	REQUIRE(dictionary_compressor.reset() == OK);
+	CHECK(_run_stream(dictionary_compressor, payload, compressed, 1024) == OK);
+	CompressionStream plain_decompressor;
+	REQUIRE(plain_decompressor.start_decompression(Compression::MODE_ZSTD) == OK);
+	ERR_PRINT_OFF
+	CHECK(_run_stream(plain_decompressor, compressed, decompressed, 1024) == ERR_FILE_CORRUPT);
+	ERR_PRINT_ON
+}
+
+} // namespace TestCompression
@@ -297,4 +297,51 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] Compressed files with many blocks") {
+	// Large enough to span many blocks, so that blocks are compressed and read ahead in batches.
+	Vector<uint8_t> contents;
+	contents.resize(1000000);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = (i * 31 + i / 1000) % 251;
+	}
+
+	FileAccess::CompressionMode mode = FileAccess::COMPRESSION_ZSTD;
+	SUBCASE("Zstandard") {
+		mode = FileAccess::COMPRESSION_ZSTD;
+	}
+	SUBCASE("FastLZ") {
+		mode = FileAccess::COMPRESSION_FASTLZ;
+	}
+	SUBCASE("Deflate") {
+		mode = FileAccess::COMPRESSION_DEFLATE;
+	}
+
+	const String path = TestUtils::get_temp_path("compressed_many_blocks.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open_compressed(path, FileAccess::WRITE, mode);
+		REQUIRE(f.is_valid());
+		f->store_buffer(contents);
+	}
+
+	Ref<FileAccess> f = FileAccess::open_compressed(path, FileAccess::READ, mode);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == uint64_t(contents.size()));
+
+	// Sequential reads in odd sizes cross block boundaries.
+	Vector<uint8_t> read_back;
+	while (read_back.size() < contents.size()) {
+		read_back.append_array(f->get_buffer(MIN(contents.size() - read_back.size(), 9999)));
+	}
+	CHECK(read_back == contents);
+	CHECK(f->get_position() == uint64_t(contents.size()));
+
+	// Random access, inside and outside of the read-ahead window.
+	const int64_t positions[] = { 500000, 4095, 4096, 999999, 0, 123457, 123456 };
+	for (int64_t position : positions) {
+		f->seek(position);
+		CHECK(f->get_position() == uint64_t(position));
+		CHECK(f->get_8() == contents[position]);
+	}
+}
+
 } // namespace TestFileAccess
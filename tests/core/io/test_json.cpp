@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_json)
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 #include "core/variant/typed_array.h"
 
 namespace TestJSON {
@@ -425,4 +426,146 @@ TEST_CASE("[JSON] Serialization") {
 	}
 }
 
+TEST_CASE("[JSON] Parsing UTF-8 buffers matches parsing Strings") {
+	const String valid_inputs[] = {
+		"null",
+		"  true  ",
+		"-12.5e3",
+		"\"hello\"",
+		"\"a long string without any escape sequences in it\"",
+		"\"tab\\tnewline\\nquote\\\" slash\\/ backslash\\\\ unicode\\u00e9 \\ud83d\\ude00\"",
+		String::utf8("\"héllo wörld, こんにちは, this string is longer than a word\""),
+		"[1, 2.5, \"three\", [true, false, null], {}]",
+		"{\n\t\t\t\t\t\t\t\t\"key\": {\n                \"nested\": [1, 2, 3]\n\t}\n}",
+	};
+	for (const String &input : valid_inputs) {
+		JSON json_string;
+		JSON json_utf8;
+		const Error err_string = json_string.parse(input);
+		const Error err_utf8 = json_utf8.parse_utf8_buffer(input.to_utf8_buffer());
+		CHECK_MESSAGE(err_utf8 == OK, vformat("Parsing `%s` from UTF-8 should succeed.", input));
+		CHECK(err_utf8 == err_string);
+		CHECK_MESSAGE(
+				json_utf8.get_data() == json_string.get_data(),
+				vformat("Parsing `%s` from UTF-8 should return the same data as parsing it from a String.", input));
+	}
+
+	const String invalid_inputs[] = {
+		"",
+		"\"unterminated",
+		"\"bad escape \\q\"",
+		"\"bad hex \\u12g4\"",
+		"\"lead surrogate \\ud83d\"",
+		"\"trail surrogate \\ude00\"",
+		"[1, 2",
+		"[1 2]",
+		"{\"a\" 1}",
+		"{1: 2}",
+		"{\"a\": 1",
+		"{\"a\": 1 \"b\": 2}",
+		"nope",
+		"\n\n[1, 2,\n ]",
+		"[1] 2",
+		"@",
+	};
+	ERR_PRINT_OFF
+	for (const String &input : invalid_inputs) {
+		JSON json_string;
+		JSON json_utf8;
+		const Error err_string = json_string.parse(input);
+		const Error err_utf8 = json_utf8.parse_utf8_buffer(input.to_utf8_buffer());
+		CHECK_MESSAGE(err_utf8 != OK, vformat("Parsing `%s` from UTF-8 should fail.", input));
+		CHECK(err_utf8 == err_string);
+		CHECK_MESSAGE(
+				json_utf8.get_error_line() == json_string.get_error_line(),
+				vformat("Parsing `%s` from UTF-8 should report the same error line.", input));
+		CHECK_MESSAGE(
+				json_utf8.get_error_message() == json_string.get_error_message(),
+				vformat("Parsing `%s` from UTF-8 should report the same error message.", input));
+	}
+	ERR_PRINT_ON
+
+	JSON json;
+	PackedByteArray bom_buffer = String("{\"bom\": 1}").to_utf8_buffer();
+	bom_buffer.insert(0, 0xBF);
+	bom_buffer.insert(0, 0xBB);
+	bom_buffer.insert(0, 0xEF);
+	CHECK_MESSAGE(
+			json.parse_utf8_buffer(bom_buffer) == OK,
+			"Parsing a UTF-8 buffer starting with a byte order mark should succeed.");
+	CHECK(double(Dictionary(json.get_data())["bom"]) == 1.0);
+
+	const String text = "{\"kept\": true}";
+	json.parse_utf8_buffer(text.to_utf8_buffer(), true);
+	CHECK(json.get_parsed_text() == text);
+}
+
+TEST_CASE("[JSON] Stringifying to UTF-8 buffers matches stringifying to Strings") {
+	Dictionary nested;
+	nested["text"] = String::utf8("escapes \" \\ \b \f \n \r \t \v and unicode é こんにちは");
+	nested["numbers"] = Array({ 0, -42, 9007199254740993, 0.1, -1.5e300, Math::INF, -Math::INF, Math::NaN });
+	nested["flags"] = Array({ true, false, Variant() });
+
+	Dictionary data;
+	data["zeta"] = nested;
+	data["alpha"] = Array({ Dictionary(), Array(), "" });
+	data[42] = "non-string key";
+
+	const String indents[] = { "", "\t", "   " };
+	for (const String &indent : indents) {
+		for (int sort_keys = 0; sort_keys < 2; sort_keys++) {
+			for (int full_precision = 0; full_precision < 2; full_precision++) {
+				CHECK(JSON::stringify_to_utf8_buffer(data, indent, sort_keys, full_precision) == JSON::stringify(data, indent, sort_keys, full_precision).to_utf8_buffer());
+			}
+		}
+	}
+
+	ERR_PRINT_OFF
+	Array max_recursion_array;
+	for (int i = 0; i < Variant::MAX_RECURSION_DEPTH + 1; i++) {
+		Array next;
+		next.append(max_recursion_array);
+		max_recursion_array = next;
+	}
+	CHECK(JSON::stringify_to_utf8_buffer(max_recursion_array) == JSON::stringify(max_recursion_array).to_utf8_buffer());
+	ERR_PRINT_ON
+}
+
+TEST_CASE_PENDING("[JSON][Benchmark] Parsing and stringifying UTF-8 buffers") {
+	Array records;
+	for (int i = 0; i < 20000; i++) {
+		Dictionary record;
+		record["id"] = i;
+		record["name"] = vformat("record number %d with a reasonably long name", i);
+		record["position"] = Array({ i * 0.5, i * -0.25, 1.0 / (i + 1) });
+		record["tags"] = Array({ "alpha", "beta", String::utf8("gämma") });
+		record["enabled"] = (i % 2) == 0;
+		records.push_back(record);
+	}
+	const String text = JSON::stringify(records, "\t");
+	const PackedByteArray bytes = text.to_utf8_buffer();
+	MESSAGE(vformat("JSON document size: %d bytes.", bytes.size()));
+
+	JSON json;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	json.parse(bytes.get_string_from_utf8());
+	const uint64_t string_parse_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	json.parse_utf8_buffer(bytes);
+	const uint64_t utf8_parse_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	const PackedByteArray string_result = JSON::stringify(records, "\t").to_utf8_buffer();
+	const uint64_t string_stringify_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	const PackedByteArray utf8_result = JSON::stringify_to_utf8_buffer(records, "\t");
+	const uint64_t utf8_stringify_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	CHECK(string_result == utf8_result);
+	MESSAGE(vformat("Parse: %d usec via String, %d usec via UTF-8 buffer.", string_parse_usec, utf8_parse_usec));
+	MESSAGE(vformat("Stringify: %d usec via String, %d usec via UTF-8 buffer.", string_stringify_usec, utf8_stringify_usec));
+}
+
 } // namespace TestJSON
@@ -490,4 +490,100 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Packed array encoding and decoding") {
+	PackedInt32Array int32_array = { 1, -2, 0x12345678 };
+	PackedInt64Array int64_array = { 1, -2, 0x0123456789abcdef };
+	PackedFloat32Array float32_array = { 0.5, -1.25 };
+	PackedFloat64Array float64_array = { 0.1, -1e300 };
+	PackedByteArray byte_array = { 1, 2, 3, 4, 5 };
+
+	const Variant arrays[] = { int32_array, int64_array, float32_array, float64_array, byte_array, PackedInt32Array() };
+	for (const Variant &array : arrays) {
+		int len;
+		REQUIRE(encode_variant(array, nullptr, len) == OK);
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		REQUIRE(encode_variant(array, buffer.ptrw(), len) == OK);
+
+		Variant decoded;
+		int r_len;
+		CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &r_len) == OK);
+		CHECK(r_len == len);
+		CHECK(decoded.get_type() == array.get_type());
+		CHECK(decoded == array);
+	}
+
+	// Elements are stored little-endian.
+	int len;
+	uint8_t buffer[16];
+	REQUIRE(encode_variant(PackedInt32Array({ 0x12345678, 1 }), buffer, len) == OK);
+	CHECK(len == 16);
+	CHECK(buffer[8] == 0x78);
+	CHECK(buffer[11] == 0x12);
+	CHECK(buffer[12] == 0x01);
+}
+
+TEST_CASE("[Marshalls] Packed array view decoding") {
+	PackedFloat64Array float64_array = { 0.1, -1e300, 42.0 };
+	LocalVector<uint8_t> buffer;
+	REQUIRE(encode_variant_to_buffer(float64_array, buffer) == OK);
+
+	PackedArrayView view;
+	int r_len;
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == int(buffer.size()));
+	CHECK(view.type == Variant::PACKED_FLOAT64_ARRAY);
+	CHECK(view.count == 3);
+	CHECK(view.get_element_size() == 8);
+	CHECK_MESSAGE(view.data == buffer.ptr() + 8, "The view should reference the encoded elements without copying them.");
+	CHECK(decode_double(view.data + 8) == -1e300);
+	CHECK(view.to_variant() == Variant(float64_array));
+
+	// Byte arrays are padded to 4 bytes.
+	buffer.clear();
+	REQUIRE(encode_variant_to_buffer(PackedByteArray({ 1, 2, 3, 4, 5 }), buffer) == OK);
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == 16);
+	CHECK(view.count == 5);
+	CHECK(view.data[4] == 5);
+
+	// Other types must be decoded into a Variant.
+	buffer.clear();
+	REQUIRE(encode_variant_to_buffer(PackedStringArray({ "a" }), buffer) == OK);
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size(), &r_len) == ERR_UNAVAILABLE);
+
+	// Truncated data is rejected.
+	buffer.clear();
+	REQUIRE(encode_variant_to_buffer(PackedInt32Array({ 1, 2 }), buffer) == OK);
+	ERR_PRINT_OFF;
+	CHECK(decode_packed_array_view(view, buffer.ptr(), buffer.size() - 4, &r_len) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Marshalls] Encoding into a reusable buffer") {
+	LocalVector<uint8_t> buffer;
+
+	// Variants are appended after the existing contents.
+	REQUIRE(encode_variant_to_buffer(Variant(1), buffer) == OK);
+	CHECK(buffer.size() == 8);
+	REQUIRE(encode_variant_to_buffer(Variant("Hello"), buffer) == OK);
+	CHECK(buffer.size() == 8 + 16);
+
+	Variant decoded;
+	int r_len;
+	CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == 8);
+	CHECK(decoded == Variant(1));
+	CHECK(decode_variant(decoded, buffer.ptr() + 8, buffer.size() - 8, &r_len) == OK);
+	CHECK(decoded == Variant("Hello"));
+
+	// Clearing the buffer keeps its memory for the next packet.
+	const uint8_t *memory = buffer.ptr();
+	buffer.clear();
+	REQUIRE(encode_variant_to_buffer(Vector2(1, 2), buffer) == OK);
+	CHECK(buffer.ptr() == memory);
+	CHECK(decode_variant(decoded, buffer.ptr(), buffer.size()) == OK);
+	CHECK(decoded == Variant(Vector2(1, 2)));
+}
+
 } // namespace TestMarshalls
@@ -32,11 +32,24 @@
 
 TEST_FORCE_LINK(test_pck_packer)
 
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 #include "tests/test_utils.h"
 
+class TestPCKPackerInternalsAccessor {
+public:
+	static void set_pending_batch_size(PCKPacker &p_packer, uint64_t p_size) {
+		p_packer.pending_batch_size = p_size;
+	}
+
+	static int get_written_file_count(const PCKPacker &p_packer) {
+		return p_packer.first_pending_file;
+	}
+};
+
 namespace TestPCKPacker {
 
 TEST_CASE("[PCKPacker] Pack an empty PCK file") {
@@ -120,4 +133,155 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			"The generated non-empty PCK file shouldn't be too large.");
 }
 
+TEST_CASE("[PCKPacker] Read packed files through a memory-mapped pack") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+
+	Vector<uint8_t> contents;
+	contents.resize(10000);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = i * 7;
+	}
+	REQUIRE(pck_packer.add_file_from_buffer("mapped_pck_test/data.bin", contents) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+
+	for (int use_mappings = 1; use_mappings >= 0; use_mappings--) {
+		packed_data->set_use_pack_mappings(use_mappings);
+
+		Ref<FileAccess> f = FileAccess::open("res://mapped_pck_test/data.bin", FileAccess::READ);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == uint64_t(contents.size()));
+
+		const Span<uint8_t> mapped = f->get_mapped_span();
+		if (use_mappings) {
+#if defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+			CHECK_MESSAGE(mapped.size() == uint64_t(contents.size()), "The pack should be memory-mapped on this platform.");
+#endif
+		} else {
+			CHECK(mapped.is_empty());
+		}
+		if (!mapped.is_empty()) {
+			CHECK(memcmp(mapped.ptr(), contents.ptr(), contents.size()) == 0);
+		}
+
+		f->seek(100);
+		CHECK(f->get_8() == contents[100]);
+		f->seek(0);
+		CHECK(f->get_buffer(contents.size()) == contents);
+		CHECK_FALSE(f->eof_reached());
+		CHECK(f->get_8() == 0);
+		CHECK(f->eof_reached());
+	}
+
+	packed_data->set_use_pack_mappings(true);
+	packed_data->remove_pack(output_pck_path);
+	CHECK_FALSE(FileAccess::exists("res://mapped_pck_test/data.bin"));
+}
+
+TEST_CASE("[PCKPacker] Pack many files in batches") {
+	PackedData *packed_data = PackedData::get_singleton();
+
+	// A pack with the files that the batched pack removes.
+	const String base_pck_path = TestUtils::get_temp_path("output_many_files_base.pck");
+	{
+		PCKPacker base_packer;
+		REQUIRE(base_packer.pck_start(base_pck_path) == OK);
+		for (int i = 0; i < 64; i += 16) {
+			REQUIRE(base_packer.add_file_from_buffer(vformat("many_files_pck_test/removed_%d.bin", i), Vector<uint8_t>{ uint8_t(i) }) == OK);
+		}
+		REQUIRE(base_packer.flush() == OK);
+	}
+	REQUIRE(packed_data->add_pack(base_pck_path, false, 0) == OK);
+	for (int i = 0; i < 64; i += 16) {
+		REQUIRE(FileAccess::exists(vformat("res://many_files_pck_test/removed_%d.bin", i)));
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_many_files.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path, 16) == OK);
+	// Small enough that pending files are written several times before flush().
+	TestPCKPackerInternalsAccessor::set_pending_batch_size(pck_packer, 16 * 1024);
+
+	// Mix files read from disk, buffers and removals, which are all written in order.
+	const String source_path = TestUtils::get_temp_path("pck_packer_source.bin");
+	Vector<uint8_t> source_contents;
+	source_contents.resize(5000);
+	for (int i = 0; i < source_contents.size(); i++) {
+		source_contents.write[i] = i % 13;
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(source_contents);
+	}
+
+	Vector<Vector<uint8_t>> buffers;
+	for (int i = 0; i < 64; i++) {
+		Vector<uint8_t> buffer;
+		buffer.resize(i * 100);
+		for (int j = 0; j < buffer.size(); j++) {
+			buffer.write[j] = (i + j) % 256;
+		}
+		buffers.push_back(buffer);
+		REQUIRE(pck_packer.add_file_from_buffer(vformat("many_files_pck_test/buffer_%d.bin", i), buffer) == OK);
+		if (i % 16 == 0) {
+			REQUIRE(pck_packer.add_file(vformat("many_files_pck_test/source_%d.bin", i), source_path) == OK);
+			REQUIRE(pck_packer.add_file_removal(vformat("many_files_pck_test/removed_%d.bin", i)) == OK);
+		}
+	}
+	CHECK_MESSAGE(TestPCKPackerInternalsAccessor::get_written_file_count(pck_packer) > 0, "Some batches should have been written before flush().");
+	REQUIRE(pck_packer.flush() == OK);
+
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+
+	for (int i = 0; i < buffers.size(); i++) {
+		Ref<FileAccess> f = FileAccess::open(vformat("res://many_files_pck_test/buffer_%d.bin", i), FileAccess::READ);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_buffer(f->get_length()) == buffers[i]);
+	}
+	for (int i = 0; i < buffers.size(); i += 16) {
+		CHECK(FileAccess::get_file_as_bytes(vformat("res://many_files_pck_test/source_%d.bin", i)) == source_contents);
+		CHECK_FALSE(FileAccess::exists(vformat("res://many_files_pck_test/removed_%d.bin", i)));
+	}
+
+	packed_data->remove_pack(output_pck_path);
+	packed_data->remove_pack(base_pck_path);
+	CHECK_FALSE(FileAccess::exists("res://many_files_pck_test/buffer_0.bin"));
+}
+
+TEST_CASE("[PCKPacker] Source files are read when added") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_removed_source.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+
+	// The source is overwritten and then removed before flush(), the PCK must keep the original contents.
+	const String source_path = TestUtils::get_temp_path("pck_packer_temp_source.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("original");
+	}
+	REQUIRE(pck_packer.add_file("removed_source_pck_test/source.txt", source_path) == OK);
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("overwritten");
+	}
+	REQUIRE(DirAccess::remove_absolute(source_path) == OK);
+
+	CHECK(pck_packer.add_file("removed_source_pck_test/missing.txt", source_path) == ERR_FILE_CANT_OPEN);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+	CHECK(FileAccess::get_file_as_string("res://removed_source_pck_test/source.txt") == "original");
+	CHECK_FALSE(FileAccess::exists("res://removed_source_pck_test/missing.txt"));
+
+	packed_data->remove_pack(output_pck_path);
+}
+
 } // namespace TestPCKPacker
@@ -33,13 +33,29 @@
 TEST_FORCE_LINK(test_resource)
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/os/os.h"
+#include "core/os/safe_binary_mutex.h"
 #include "scene/main/node.h"
 #include "tests/test_utils.h"
 
 #include <functional>
 
+class TestResourceLoaderInternalsAccessor {
+public:
+	static HashSet<String> get_sub_tasks(const String &p_path) {
+		MutexLock thread_load_lock(ResourceLoader::thread_load_mutex);
+		HashMap<String, ResourceLoader::ThreadLoadTask>::Iterator E = ResourceLoader::thread_load_tasks.find(ResourceLoader::_validate_local_path(p_path));
+		return E ? E->value.sub_tasks : HashSet<String>();
+	}
+
+	static String get_local_path(const String &p_path) {
+		return ResourceLoader::_validate_local_path(p_path);
+	}
+};
+
 namespace TestResource {
 
 enum TestDuplicateMode {
@@ -572,6 +588,53 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Binary format packed arrays and property index") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Main");
+	// Odd sizes, so that every following array needs padding to be aligned.
+	resource->set_meta("bytes", PackedByteArray({ 1, 2, 3 }));
+	resource->set_meta("int32s", PackedInt32Array({ 1, -2, 3 }));
+	resource->set_meta("int64s", PackedInt64Array({ 1, -2, 0x0123456789abcdef }));
+	resource->set_meta("float32s", PackedFloat32Array({ 0.5, -1.5, 2.5 }));
+	resource->set_meta("float64s", PackedFloat64Array({ 0.1, -1e300 }));
+	resource->set_meta("vector2s", PackedVector2Array({ Vector2(1, 2) }));
+	resource->set_meta("vector3s", PackedVector3Array({ Vector3(1, 2, 3), Vector3(4, 5, 6) }));
+	resource->set_meta("colors", PackedColorArray({ Color(0.25, 0.5, 0.75, 1.0) }));
+	resource->set_meta("vector4s", PackedVector4Array({ Vector4(1, 2, 3, 4) }));
+	Ref<Resource> child_resource = memnew(Resource);
+	child_resource->set_name("Child");
+	child_resource->set_scene_unique_id("child");
+	child_resource->set_meta("values", PackedInt32Array({ 7, 8, 9 }));
+	resource->set_meta("child", child_resource);
+
+	const String save_path = TestUtils::get_temp_path("resource_index.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	for (const String &name : { "bytes", "int32s", "int64s", "float32s", "float64s", "vector2s", "vector3s", "colors", "vector4s" }) {
+		CHECK_MESSAGE(loaded_resource->get_meta(name) == resource->get_meta(name), vformat("Packed array \"%s\" should be loaded unchanged.", name));
+	}
+	const Ref<Resource> loaded_child_resource = loaded_resource->get_meta("child");
+	REQUIRE(loaded_child_resource.is_valid());
+	CHECK(loaded_child_resource->get_meta("values") == Variant(PackedInt32Array({ 7, 8, 9 })));
+
+	// Single properties can be read without loading the resource.
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Variant value;
+	CHECK(loader->load_resource_property(save_path, "", "metadata/float64s", value) == OK);
+	CHECK(value == resource->get_meta("float64s"));
+	CHECK(loader->load_resource_property(save_path, "", "resource_name", value) == OK);
+	CHECK(value == Variant("Main"));
+	CHECK(loader->load_resource_property(save_path, "child", "metadata/values", value) == OK);
+	CHECK(value == Variant(PackedInt32Array({ 7, 8, 9 })));
+	CHECK(loader->load_resource_property(save_path, "", "metadata/missing", value) == ERR_DOES_NOT_EXIST);
+	ERR_PRINT_OFF;
+	CHECK(loader->load_resource_property(save_path, "missing", "resource_name", value) == ERR_DOES_NOT_EXIST);
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -627,4 +690,61 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	resource_c->remove_meta("next");
 }
 
+TEST_CASE("[Resource] Threaded loading progress with external dependencies") {
+	// Diamond shaped graph: the main resource depends on two resources sharing a third one.
+	const String shared_path = TestUtils::get_temp_path("threaded_progress_shared.tres");
+	const String left_path = TestUtils::get_temp_path("threaded_progress_left.tres");
+	const String right_path = TestUtils::get_temp_path("threaded_progress_right.tres");
+	const String main_path = TestUtils::get_temp_path("threaded_progress_main.tres");
+	{
+		Ref<Resource> shared = memnew(Resource);
+		shared->set_name("Shared");
+		REQUIRE(ResourceSaver::save(shared, shared_path, ResourceSaver::FLAG_CHANGE_PATH) == OK);
+		Ref<Resource> left = memnew(Resource);
+		left->set_name("Left");
+		left->set_meta("shared", shared);
+		REQUIRE(ResourceSaver::save(left, left_path, ResourceSaver::FLAG_CHANGE_PATH) == OK);
+		Ref<Resource> right = memnew(Resource);
+		right->set_name("Right");
+		right->set_meta("shared", shared);
+		REQUIRE(ResourceSaver::save(right, right_path, ResourceSaver::FLAG_CHANGE_PATH) == OK);
+		Ref<Resource> main = memnew(Resource);
+		main->set_name("Main");
+		main->set_meta("left", left);
+		main->set_meta("right", right);
+		REQUIRE(ResourceSaver::save(main, main_path) == OK);
+	}
+	// The saved resources are freed here, so they are loaded from disk and not taken from the cache.
+
+	REQUIRE(ResourceLoader::load_threaded_request(main_path, "", true) == OK);
+
+	float progress = 0.0;
+	float last_progress = 0.0;
+	ResourceLoader::ThreadLoadStatus status = ResourceLoader::load_threaded_get_status(main_path, &progress);
+	while (status == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+		CHECK_MESSAGE(progress >= last_progress, "Progress should never go backwards.");
+		last_progress = progress;
+		OS::get_singleton()->delay_usec(1000);
+		status = ResourceLoader::load_threaded_get_status(main_path, &progress);
+	}
+	REQUIRE(status == ResourceLoader::THREAD_LOAD_LOADED);
+	CHECK(progress >= last_progress);
+	CHECK(progress == doctest::Approx(1.0));
+
+	// Dependencies handed to the pool are tracked as sub-tasks of the resource requesting them.
+	HashSet<String> sub_tasks = TestResourceLoaderInternalsAccessor::get_sub_tasks(main_path);
+	CHECK(sub_tasks.has(TestResourceLoaderInternalsAccessor::get_local_path(left_path)));
+	CHECK(sub_tasks.has(TestResourceLoaderInternalsAccessor::get_local_path(right_path)));
+
+	const Ref<Resource> loaded_main = ResourceLoader::load_threaded_get(main_path);
+	REQUIRE(loaded_main.is_valid());
+	const Ref<Resource> loaded_left = loaded_main->get_meta("left");
+	const Ref<Resource> loaded_right = loaded_main->get_meta("right");
+	REQUIRE(loaded_left.is_valid());
+	REQUIRE(loaded_right.is_valid());
+	CHECK(loaded_left->get_name() == "Left");
+	CHECK(loaded_right->get_name() == "Right");
+	CHECK(Ref<Resource>(loaded_left->get_meta("shared")) == Ref<Resource>(loaded_right->get_meta("shared")));
+}
+
 } // namespace TestResource
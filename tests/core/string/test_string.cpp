@@ -32,6 +32,7 @@
 
 TEST_FORCE_LINK(test_string)
 
+#include "core/os/os.h"
 #include "core/string/ustring.h"
 
 namespace TestString {
@@ -134,6 +135,50 @@ TEST_CASE("[String] UTF8 with BOM") {
 	CHECK(String::utf8(cs) == s);
 }
 
+TEST_CASE("[String] UTF8 with long ASCII runs") {
+	// Runs of every length around the 8-byte fast path, separated by multibyte characters.
+	String expected;
+	for (int run = 0; run < 20; run++) {
+		for (int i = 0; i < run; i++) {
+			expected += char32_t('a' + i);
+		}
+		expected += char32_t(0x304A);
+		expected += char32_t(0x1F3A4);
+	}
+
+	Vector<uint8_t> ch_length_map;
+	CharString cs = expected.utf8(&ch_length_map);
+	CHECK(cs.length() == expected.length() + 20 * 5);
+	REQUIRE(ch_length_map.size() == expected.length());
+	int matching_widths = 0;
+	for (int i = 0; i < expected.length(); i++) {
+		const int width = expected[i] < 0x80 ? 1 : (expected[i] < 0x10000 ? 3 : 4);
+		matching_widths += ch_length_map[i] == width ? 1 : 0;
+	}
+	CHECK(matching_widths == expected.length());
+
+	String parsed;
+	Error err = parsed.append_utf8(cs.get_data(), cs.length());
+	CHECK(err == OK);
+	CHECK(parsed == expected);
+
+	// A null byte inside an ASCII run still ends the string.
+	const char with_null[] = "0123456789\0abcdefghij";
+	parsed.clear();
+	err = parsed.append_utf8(with_null, sizeof(with_null) - 1);
+	CHECK(err == OK);
+	CHECK(parsed == "0123456789");
+
+	// Invalid bytes after an ASCII run are still reported.
+	const char invalid[] = "0123456789abcdef\xff";
+	parsed.clear();
+	ERR_PRINT_OFF
+	err = parsed.append_utf8(invalid);
+	ERR_PRINT_ON
+	CHECK(err == ERR_INVALID_DATA);
+	CHECK(parsed == String("0123456789abcdef") + char32_t(0xFFFD));
+}
+
 TEST_CASE("[String] UTF16 with BOM") {
 	/* how can i embed UTF in here? */
 	static const char32_t u32str[] = { 0x0020, 0x0045, 0x304A, 0x360F, 0x3088, 0x3046, 0x1F3A4, 0 };
@@ -2245,4 +2290,58 @@ TEST_CASE("[String][URL] Parse URL") {
 #undef CHECK_URL
 }
 
+TEST_CASE_PENDING("[String][Benchmark] UTF-8 conversion, find, split and replace") {
+	String ascii;
+	String mixed;
+	for (int i = 0; i < 20000; i++) {
+		ascii += "lorem ipsum dolor sit amet, " + itos(i) + "\n";
+		mixed += String(U"lorem ipsum ドロル sit amet, ") + itos(i) + "\n";
+	}
+	const CharString ascii_utf8 = ascii.utf8();
+	const CharString mixed_utf8 = mixed.utf8();
+	const int rounds = 20;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(String::utf8(ascii_utf8.get_data(), ascii_utf8.length()).length() == ascii.length());
+	}
+	MESSAGE(vformat("parse_utf8 (ASCII, %d bytes): %d usec.", ascii_utf8.length(), (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(String::utf8(mixed_utf8.get_data(), mixed_utf8.length()).length() == mixed.length());
+	}
+	MESSAGE(vformat("parse_utf8 (mixed, %d bytes): %d usec.", mixed_utf8.length(), (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(ascii.utf8().length() == ascii_utf8.length());
+	}
+	MESSAGE(vformat("utf8 (ASCII): %d usec.", (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(mixed.utf8().length() == mixed_utf8.length());
+	}
+	MESSAGE(vformat("utf8 (mixed): %d usec.", (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(ascii.find("amet, 19999") > 0);
+	}
+	MESSAGE(vformat("find: %d usec.", (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(ascii.split("\n", false).size() == 20000);
+	}
+	MESSAGE(vformat("split: %d usec.", (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		CHECK(ascii.replace("dolor", "DOLOR").length() == ascii.length());
+	}
+	MESSAGE(vformat("replace: %d usec.", (OS::get_singleton()->get_ticks_usec() - begin) / rounds));
+}
+
 } // namespace TestString
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*  test_string_name.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_string_name)
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	StringName a = "test_string_name_interning";
+	StringName b = String("test_string_name_interning");
+	StringName c = "test_string_name_interning_other";
+
+	CHECK(a == b);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a != c);
+	CHECK(a.hash() == String("test_string_name_interning").hash());
+	CHECK(String(a) == "test_string_name_interning");
+
+	CHECK(StringName().is_empty());
+	CHECK(StringName("").is_empty());
+	CHECK(StringName(String()).is_empty());
+}
+
+TEST_CASE("[StringName] Re-interning a released name") {
+	const String name = "test_string_name_released";
+	{
+		StringName first = name;
+		CHECK(first == name);
+	}
+	StringName second = name;
+	StringName third = name;
+	CHECK(second == name);
+	CHECK(second.data_unique_pointer() == third.data_unique_pointer());
+}
+
+struct InternThreadData {
+	uint32_t name_count = 0;
+	uint32_t rounds = 0;
+	uint32_t offset = 0;
+	LocalVector<StringName> kept;
+};
+
+static void intern_names(void *p_userdata) {
+	InternThreadData *data = (InternThreadData *)p_userdata;
+	data->kept.resize(data->name_count);
+	for (uint32_t round = 0; round < data->rounds; round++) {
+		for (uint32_t i = 0; i < data->name_count; i++) {
+			// Start at different places so threads race on creating and freeing the same names.
+			uint32_t index = (i + data->offset) % data->name_count;
+			StringName transient = "test_string_name_mt_" + itos(index);
+			if (round == data->rounds - 1) {
+				data->kept[index] = transient;
+			}
+		}
+	}
+}
+
+TEST_CASE("[StringName] Interning from several threads") {
+	const uint32_t thread_count = 4;
+	const uint32_t name_count = 2000;
+
+	// Half of the names stay alive all along, so lookups must find them.
+	LocalVector<StringName> resident;
+	for (uint32_t i = 0; i < name_count; i += 2) {
+		resident.push_back("test_string_name_mt_" + itos(i));
+	}
+
+	InternThreadData data[thread_count];
+	Thread threads[thread_count];
+	for (uint32_t i = 0; i < thread_count; i++) {
+		data[i].name_count = name_count;
+		data[i].rounds = 4;
+		data[i].offset = i * name_count / thread_count;
+		threads[i].start(intern_names, &data[i]);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	bool all_match = true;
+	for (uint32_t i = 0; i < name_count; i++) {
+		const String expected = "test_string_name_mt_" + itos(i);
+		for (uint32_t j = 0; j < thread_count; j++) {
+			// Reduce number of check messages.
+			all_match &= data[j].kept[i] == expected;
+			all_match &= data[j].kept[i].data_unique_pointer() == data[0].kept[i].data_unique_pointer();
+		}
+		if (i % 2 == 0) {
+			all_match &= resident[i / 2].data_unique_pointer() == data[0].kept[i].data_unique_pointer();
+		}
+	}
+	CHECK(all_match);
+}
+
+static void intern_existing_names(void *p_userdata) {
+	const LocalVector<String> *names = (const LocalVector<String> *)p_userdata;
+	for (int round = 0; round < 50; round++) {
+		for (const String &name : *names) {
+			StringName sn = name;
+		}
+	}
+}
+
+TEST_CASE_PENDING("[StringName][Benchmark] Interning existing names from N threads") {
+	const uint32_t name_count = 10000;
+
+	LocalVector<String> names;
+	LocalVector<StringName> resident;
+	for (uint32_t i = 0; i < name_count; i++) {
+		names.push_back("test_string_name_bench_" + itos(i));
+		resident.push_back(names[i]);
+	}
+
+	const uint32_t max_threads = MAX(1, OS::get_singleton()->get_processor_count());
+	for (uint32_t thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+		LocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (Thread &thread : threads) {
+			thread.start(intern_existing_names, &names);
+		}
+		for (Thread &thread : threads) {
+			thread.wait_to_finish();
+		}
+		uint64_t elapsed = MAX(1u, OS::get_singleton()->get_ticks_usec() - begin);
+
+		const double lookups = 50.0 * name_count * thread_count;
+		MESSAGE(vformat("%d threads: %d usec (%.0f lookups/s).", thread_count, elapsed, lookups * 1000000.0 / elapsed));
+	}
+}
+
+} // namespace TestStringName
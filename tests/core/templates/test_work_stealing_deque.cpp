@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_work_stealing_deque)
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner pops LIFO, thieves steal FIFO") {
+	WorkStealingDeque<uint64_t, 8> deque;
+	uint64_t value = 0;
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+
+	for (uint64_t i = 1; i <= 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size() == 4);
+
+	CHECK(deque.pop(value));
+	CHECK(value == 4);
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+	CHECK(deque.steal(value));
+	CHECK(value == 2);
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Push fails when full and the ring wraps around") {
+	WorkStealingDeque<uint64_t, 4> deque;
+	uint64_t value = 0;
+
+	for (uint64_t i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.push(4));
+
+	// Free up slots from the top, then refill past the end of the buffer.
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.push(4));
+	CHECK(deque.push(5));
+	CHECK_FALSE(deque.push(6));
+
+	for (uint64_t i = 2; i < 6; i++) {
+		CHECK(deque.steal(value));
+		CHECK(value == i);
+	}
+	CHECK(deque.is_empty());
+}
+
+struct StressData {
+	WorkStealingDeque<uint64_t, 64> deque;
+	LocalVector<SafeNumeric<uint32_t>> seen;
+	SafeFlag done;
+};
+
+static void steal_loop(void *p_userdata) {
+	StressData *data = (StressData *)p_userdata;
+	uint64_t value = 0;
+	while (!data->done.is_set() || !data->deque.is_empty()) {
+		if (data->deque.steal(value)) {
+			data->seen[value].increment();
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingDeque] Every pushed item is taken exactly once under contention") {
+	const uint32_t item_count = 100000;
+
+	StressData data;
+	data.seen.resize(item_count);
+
+	Thread thieves[3];
+	for (Thread &thief : thieves) {
+		thief.start(steal_loop, &data);
+	}
+
+	uint64_t value = 0;
+	for (uint32_t i = 0; i < item_count; i++) {
+		while (!data.deque.push(i)) {
+			// Full, help drain it.
+			if (data.deque.pop(value)) {
+				data.seen[value].increment();
+			}
+		}
+		if (i % 3 == 0 && data.deque.pop(value)) {
+			data.seen[value].increment();
+		}
+	}
+	while (data.deque.pop(value)) {
+		data.seen[value].increment();
+	}
+	data.done.set();
+
+	for (Thread &thief : thieves) {
+		thief.wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < item_count; i++) {
+		// Reduce number of check messages.
+		all_taken_once &= data.seen[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+}
+
+} // namespace TestWorkStealingDeque
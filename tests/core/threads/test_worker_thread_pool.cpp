@@ -172,4 +172,100 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+struct FanOutData {
+	WorkerThreadPool *pool = nullptr;
+	uint32_t inner_count = 0;
+	LocalVector<SafeNumeric<uint32_t>> *results = nullptr;
+	uint32_t outer_index = 0;
+};
+
+static void static_inner_task(void *p_arg) {
+	SafeNumeric<uint32_t> *result = (SafeNumeric<uint32_t> *)p_arg;
+	result->increment();
+}
+
+static void static_fan_out_task(void *p_arg) {
+	FanOutData *data = (FanOutData *)p_arg;
+	// Posted from a pool thread, so these go to its local queue and can be stolen.
+	LocalVector<WorkerThreadPool::TaskID> inner_tasks;
+	inner_tasks.resize(data->inner_count);
+	for (uint32_t i = 0; i < data->inner_count; i++) {
+		SafeNumeric<uint32_t> *result = &(*data->results)[data->outer_index * data->inner_count + i];
+		inner_tasks[i] = data->pool->add_native_task(static_inner_task, result, true);
+	}
+	for (uint32_t i = 0; i < data->inner_count; i++) {
+		data->pool->wait_for_task_completion(inner_tasks[i]);
+	}
+}
+
+static uint64_t run_fan_out(WorkerThreadPool *p_pool, uint32_t p_outer_count, uint32_t p_inner_count, LocalVector<SafeNumeric<uint32_t>> &r_results) {
+	r_results.clear();
+	r_results.resize(p_outer_count * p_inner_count);
+
+	LocalVector<FanOutData> data;
+	data.resize(p_outer_count);
+	LocalVector<WorkerThreadPool::TaskID> outer_tasks;
+	outer_tasks.resize(p_outer_count);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t i = 0; i < p_outer_count; i++) {
+		data[i].pool = p_pool;
+		data[i].inner_count = p_inner_count;
+		data[i].results = &r_results;
+		data[i].outer_index = i;
+		outer_tasks[i] = p_pool->add_native_task(static_fan_out_task, &data[i], true);
+	}
+	for (uint32_t i = 0; i < p_outer_count; i++) {
+		p_pool->wait_for_task_completion(outer_tasks[i]);
+	}
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+TEST_CASE("[WorkerThreadPool] Process tasks posted from within tasks") {
+	// More than a local queue can hold, so the overflow to the shared queue is exercised too.
+	const uint32_t inner_count = WorkStealingDeque<void *>::get_capacity() + 32;
+
+	for (int work_stealing = 0; work_stealing < 2; work_stealing++) {
+		WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+		pool->init(-1, 0.3, work_stealing);
+
+		LocalVector<SafeNumeric<uint32_t>> results;
+		run_fan_out(pool, 8, inner_count, results);
+
+		bool all_run_once = true;
+		for (uint32_t i = 0; i < results.size(); i++) {
+			//Reduce number of check messages
+			all_run_once &= results[i].get() == 1;
+		}
+		CHECK(all_run_once);
+
+		pool->finish();
+		memdelete(pool);
+	}
+}
+
+TEST_CASE_PENDING("[WorkerThreadPool][Benchmark] Task throughput with and without work stealing") {
+	const uint32_t outer_count = 256;
+	const uint32_t inner_count = 1024;
+	const int rounds = 5;
+
+	uint64_t best_usec[2] = { UINT64_MAX, UINT64_MAX };
+	for (int work_stealing = 0; work_stealing < 2; work_stealing++) {
+		WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+		pool->init(-1, 0.3, work_stealing);
+
+		LocalVector<SafeNumeric<uint32_t>> results;
+		for (int round = 0; round < rounds; round++) {
+			best_usec[work_stealing] = MIN(best_usec[work_stealing], run_fan_out(pool, outer_count, inner_count, results));
+		}
+
+		pool->finish();
+		memdelete(pool);
+	}
+
+	const double tasks = outer_count * (inner_count + 1);
+	MESSAGE(vformat("Shared queue: %d usec (%.0f tasks/s).", best_usec[0], tasks * 1000000.0 / best_usec[0]));
+	MESSAGE(vformat("Work stealing: %d usec (%.0f tasks/s).", best_usec[1], tasks * 1000000.0 / best_usec[1]));
+}
+
 } // namespace TestWorkerThreadPool
@@ -32,7 +32,10 @@
 
 TEST_FORCE_LINK(test_animation_player)
 
+#include "core/config/project_settings.h"
+#include "scene/2d/node_2d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
 #include "scene/resources/animation.h"
 
 namespace TestAnimationPlayer {
@@ -62,4 +65,106 @@ TEST_CASE("[AnimationPlayer] get & set blend_time") {
 	memdelete(animation_player);
 }
 
+// Records what other nodes see of the target while the frame is being processed.
+class TargetPositionProbe : public Node {
+	GDCLASS(TargetPositionProbe, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			positions.push_back(target->get_position());
+		}
+	}
+
+public:
+	Node2D *target = nullptr;
+	Vector<Vector2> positions;
+};
+
+static Node *_create_animated_target(const Ref<AnimationLibrary> &p_library) {
+	Node *holder = memnew(Node);
+	Node2D *target = memnew(Node2D);
+	target->set_name("Target");
+	holder->add_child(target);
+	AnimationPlayer *animation_player = memnew(AnimationPlayer);
+	animation_player->set_name("AnimationPlayer");
+	animation_player->add_animation_library("", p_library);
+	holder->add_child(animation_player);
+	// Added after the player, so it is processed after it.
+	TargetPositionProbe *probe = memnew(TargetPositionProbe);
+	probe->set_name("Probe");
+	probe->target = target;
+	probe->set_process(true);
+	holder->add_child(probe);
+	return holder;
+}
+
+static const Vector<Vector2> &_get_probed_positions(Node *p_holder) {
+	return Object::cast_to<TargetPositionProbe>(p_holder->get_node(NodePath("Probe")))->positions;
+}
+
+static void _play_and_process(const Vector<Node *> &p_holders, int p_frames) {
+	for (Node *holder : p_holders) {
+		SceneTree::get_singleton()->get_root()->add_child(holder);
+		Object::cast_to<AnimationPlayer>(holder->get_node(NodePath("AnimationPlayer")))->play("move");
+	}
+	for (int i = 0; i < p_frames; i++) {
+		SceneTree::get_singleton()->process(0.25);
+	}
+	for (Node *holder : p_holders) {
+		SceneTree::get_singleton()->get_root()->remove_child(holder);
+	}
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Threaded blending") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(1.0);
+	int position_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(position_track, NodePath("Target:position"));
+	animation->track_insert_key(position_track, 0.0, Vector2(0, 0));
+	animation->track_insert_key(position_track, 1.0, Vector2(100, 0));
+	int visible_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(visible_track, NodePath("Target:visible"));
+	animation->value_track_set_update_mode(visible_track, Animation::UPDATE_DISCRETE);
+	animation->track_insert_key(visible_track, 0.0, true);
+	animation->track_insert_key(visible_track, 0.3, false);
+	Ref<AnimationLibrary> animation_library = memnew(AnimationLibrary);
+	animation_library->add_animation("move", animation);
+
+	Node *single_threaded = _create_animated_target(animation_library);
+	_play_and_process({ single_threaded }, 2);
+
+	// Several mixers are evaluated on the WorkerThreadPool together.
+	ProjectSettings::get_singleton()->set_setting("animation/blending/use_threads", true);
+	Node *threaded = _create_animated_target(animation_library);
+	Node *threaded_other = _create_animated_target(animation_library);
+	_play_and_process({ threaded, threaded_other }, 2);
+	ProjectSettings::get_singleton()->set_setting("animation/blending/use_threads", false);
+
+	Node2D *expected = Object::cast_to<Node2D>(single_threaded->get_node(NodePath("Target")));
+	CHECK(expected->get_position().x > 0);
+	CHECK_FALSE(expected->is_visible());
+	// Applied during the player's own processing.
+	const Vector<Vector2> &expected_probed = _get_probed_positions(single_threaded);
+	REQUIRE(expected_probed.size() == 2);
+	CHECK(expected_probed[0].x > 0);
+	CHECK(expected_probed[1].is_equal_approx(expected->get_position()));
+
+	for (Node *holder : { threaded, threaded_other }) {
+		Node2D *target = Object::cast_to<Node2D>(holder->get_node(NodePath("Target")));
+		CHECK(target->get_position().is_equal_approx(expected->get_position()));
+		CHECK_FALSE(target->is_visible());
+		// Applied when the deferred flush runs, once all nodes have been processed. Nodes processed after
+		// the player see the previous frame's values.
+		const Vector<Vector2> &probed = _get_probed_positions(holder);
+		REQUIRE(probed.size() == 2);
+		CHECK(probed[0].is_equal_approx(Vector2()));
+		CHECK(probed[1].is_equal_approx(expected_probed[0]));
+	}
+
+	memdelete(single_threaded);
+	memdelete(threaded);
+	memdelete(threaded_other);
+}
+
 } // namespace TestAnimationPlayer
@@ -32,7 +32,11 @@
 
 TEST_FORCE_LINK(test_packed_scene)
 
+#include "core/object/message_queue.h"
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
 #include "scene/resources/packed_scene.h"
+#include "tests/signal_watcher.h"
 
 namespace TestPackedScene {
 
@@ -215,6 +219,131 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Properties Repeatedly") {
+	// Create a scene to pack.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+	scene->set_rotation(0.5);
+	scene->set_z_index(3);
+
+	// Indexed property (`offset_left` is set through `set_offset(SIDE_LEFT, ...)`).
+	Control *child = memnew(Control);
+	child->set_name("Child");
+	child->set_offset(SIDE_LEFT, 15);
+	child->set_tooltip_text("Tooltip");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+	memdelete(scene);
+
+	// Setters are resolved on the first instantiation and reused afterwards.
+	for (int i = 0; i < 3; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_position() == Vector2(10, 20));
+		CHECK(instance->get_rotation() == doctest::Approx(0.5));
+		CHECK(instance->get_z_index() == 3);
+
+		Control *instance_child = Object::cast_to<Control>(instance->get_child(0));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_offset(SIDE_LEFT) == doctest::Approx(15));
+		CHECK(instance_child->get_tooltip_text() == "Tooltip");
+		memdelete(instance);
+	}
+
+	// Repacking replaces the resolved setters.
+	Node *other_scene = memnew(Node);
+	other_scene->set_name("OtherScene");
+	other_scene->set_process_priority(7);
+	packed_scene.pack(other_scene);
+	memdelete(other_scene);
+
+	Node *other_instance = packed_scene.instantiate();
+	REQUIRE(other_instance != nullptr);
+	CHECK(Object::cast_to<Node2D>(other_instance) == nullptr);
+	CHECK(other_instance->get_process_priority() == 7);
+	memdelete(other_instance);
+
+	// Values that don't match the setter argument type are still converted.
+	Ref<SceneState> state;
+	state.instantiate();
+	const int type = state->add_name("Node2D");
+	const int name = state->add_name("Root");
+	const int root = state->add_node(-1, -1, type, name, -1, -1, Node::UNIQUE_SCENE_ID_UNASSIGNED);
+	state->add_node_property(root, state->add_name("rotation"), state->add_value(2));
+	state->add_node_property(root, state->add_name("z_index"), state->add_value(4.0));
+
+	for (int i = 0; i < 2; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(state->instantiate(SceneState::GEN_EDIT_STATE_DISABLED));
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_rotation() == doctest::Approx(2.0));
+		CHECK(instance->get_z_index() == 4);
+		memdelete(instance);
+	}
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate Packed Scene Asynchronously") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	// Instantiate a pool of instances on worker threads.
+	Ref<PackedSceneInstantiation> instantiation = packed_scene->instantiate_async(8);
+	REQUIRE(instantiation.is_valid());
+	CHECK(instantiation->get_requested_count() == 8);
+	SIGNAL_WATCH(instantiation.ptr(), SNAME("completed"));
+
+	instantiation->wait();
+	CHECK(instantiation->is_completed());
+	CHECK(instantiation->get_available_count() == 8);
+
+	// The signal is emitted on the main thread, once the message queue is flushed.
+	MessageQueue::get_singleton()->flush();
+	Array signal_args = { {} };
+	SIGNAL_CHECK(SNAME("completed"), signal_args);
+	SIGNAL_UNWATCH(instantiation.ptr(), SNAME("completed"));
+
+	// Instances are detached, and are owned by the caller once taken.
+	for (int i = 0; i < 8; i++) {
+		Node *instance = instantiation->take_instance();
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_parent() == nullptr);
+		CHECK(!instance->is_inside_tree());
+		CHECK(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+		memdelete(instance);
+	}
+	CHECK(instantiation->get_available_count() == 0);
+	CHECK(instantiation->take_instance() == nullptr);
+
+	// Instances that aren't taken are freed with the handle, even while still being built.
+	Ref<PackedSceneInstantiation> unused = packed_scene->instantiate_async(4);
+	unused.unref();
+
+	ERR_PRINT_OFF;
+	CHECK(packed_scene->instantiate_async(0).is_null());
+	Ref<PackedScene> empty_scene;
+	empty_scene.instantiate();
+	CHECK(empty_scene->instantiate_async().is_null());
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
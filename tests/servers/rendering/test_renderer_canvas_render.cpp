@@ -0,0 +1,66 @@
+/**************************************************************************/
+/*  test_renderer_canvas_render.cpp                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_renderer_canvas_render)
+
+#include "servers/rendering/rendering_server.h"
+
+namespace TestRendererCanvasRender {
+
+TEST_CASE("[SceneTree][RendererCanvasRender] Canvas item commands reuse pooled memory") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const uint64_t base_memory = rs->get_rendering_info(RS::RENDERING_INFO_CANVAS_COMMAND_MEM_USED);
+
+	RID canvas_item = rs->canvas_item_create();
+	rs->canvas_item_add_rect(canvas_item, Rect2(0, 0, 10, 10), Color(1, 0, 0));
+	const uint64_t single_command_memory = rs->get_rendering_info(RS::RENDERING_INFO_CANVAS_COMMAND_MEM_USED);
+	CHECK(single_command_memory > base_memory);
+
+	for (int i = 0; i < 1000; i++) {
+		rs->canvas_item_add_rect(canvas_item, Rect2(i, 0, 10, 10), Color(1, 0, 0));
+	}
+	const uint64_t many_commands_memory = rs->get_rendering_info(RS::RENDERING_INFO_CANVAS_COMMAND_MEM_USED);
+	CHECK(many_commands_memory > single_command_memory);
+
+	SUBCASE("Clearing keeps the blocks for redrawing") {
+		rs->canvas_item_clear(canvas_item);
+		for (int i = 0; i < 1000; i++) {
+			rs->canvas_item_add_rect(canvas_item, Rect2(i, 0, 10, 10), Color(0, 1, 0));
+		}
+		CHECK(rs->get_rendering_info(RS::RENDERING_INFO_CANVAS_COMMAND_MEM_USED) == many_commands_memory);
+	}
+
+	rs->free(canvas_item);
+	CHECK(rs->get_rendering_info(RS::RENDERING_INFO_CANVAS_COMMAND_MEM_USED) == base_memory);
+}
+
+} // namespace TestRendererCanvasRender
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_renderer_scene_cull)
+
+#include "core/math/projection.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/rendering/renderer_scene_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+#include "servers/rendering/storage/render_scene_buffers.h"
+#include "servers/xr/xr_interface.h"
+
+namespace TestRendererSceneCull {
+
+static AABB random_aabb(RandomPCG &p_rng, real_t p_extent) {
+	const Vector3 position(p_rng.random(-p_extent, p_extent), p_rng.random(-p_extent, p_extent), p_rng.random(-p_extent, p_extent));
+	return AABB(position, Vector3(p_rng.random(0.1, 4.0), p_rng.random(0.1, 4.0), p_rng.random(0.1, 4.0)));
+}
+
+TEST_CASE("[RendererSceneCull] Block culling matches per-instance culling") {
+	RandomPCG rng(1234);
+
+	Projection projection;
+	projection.set_perspective(70.0, 16.0 / 9.0, 0.05, 100.0);
+	const Transform3D camera_transform(Basis::from_euler(Vector3(-0.3, 0.8, 0.0)), Vector3(2.0, 3.0, -1.0));
+	const RendererSceneCull::Frustum frustum(projection.get_projection_planes(camera_transform));
+	const AABB region(Vector3(-10.0, -10.0, -10.0), Vector3(20.0, 20.0, 20.0));
+
+	for (int round = 0; round < 64; round++) {
+		RendererSceneCull::InstanceBounds bounds[RendererSceneCull::InstanceCullBlock::SIZE];
+		RendererSceneCull::InstanceCullBlock block;
+		for (uint32_t lane = 0; lane < RendererSceneCull::InstanceCullBlock::SIZE; lane++) {
+			bounds[lane] = RendererSceneCull::InstanceBounds(random_aabb(rng, 50.0));
+			block.set_bounds(lane, bounds[lane]);
+			block.layer_mask[lane] = 1 << (rng.rand() % 4);
+			block.ignore_all_culling[lane] = rng.rand() % 8 == 0;
+		}
+
+		const uint32_t frustum_mask = block.in_frustum_mask(frustum);
+		const uint32_t region_mask = block.in_aabb_mask(region);
+		const uint32_t layer_mask = block.layer_mask_test(0b0101);
+		const uint32_t ignore_mask = block.ignore_all_culling_mask();
+		for (uint32_t lane = 0; lane < RendererSceneCull::InstanceCullBlock::SIZE; lane++) {
+			CHECK(bool(frustum_mask & (1 << lane)) == bounds[lane].in_frustum(frustum));
+			CHECK(bool(region_mask & (1 << lane)) == bounds[lane].in_aabb(region));
+			CHECK(bool(layer_mask & (1 << lane)) == bool(block.layer_mask[lane] & 0b0101));
+			CHECK(bool(ignore_mask & (1 << lane)) == bool(block.ignore_all_culling[lane]));
+		}
+	}
+}
+
+TEST_CASE_PENDING("[RendererSceneCull][Benchmark] Cull 500k instances") {
+	const int instance_count = 500000;
+	const int frames = 20;
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RandomPCG rng(42);
+
+	RID scenario = rs->scenario_create();
+	RID mesh = rs->mesh_create();
+	LocalVector<RID> instances;
+	instances.reserve(instance_count);
+	for (int i = 0; i < instance_count; i++) {
+		RID instance = rs->instance_create2(mesh, scenario);
+		const AABB aabb = random_aabb(rng, 1000.0);
+		rs->instance_set_custom_aabb(instance, AABB(Vector3(), aabb.size));
+		rs->instance_set_transform(instance, Transform3D(Basis(), aabb.position));
+		instances.push_back(instance);
+	}
+
+	RID camera = rs->camera_create();
+	rs->camera_set_perspective(camera, 75.0, 0.05, 4000.0);
+
+	Ref<RenderSceneBuffersExtension> render_buffers;
+	render_buffers.instantiate();
+	Ref<XRInterface> xr_interface;
+
+	RSG::scene->update();
+
+	uint64_t best_usec = UINT64_MAX;
+	for (int frame = 0; frame < frames; frame++) {
+		rs->camera_set_transform(camera, Transform3D(Basis::from_euler(Vector3(0.0, Math::TAU * frame / frames, 0.0)), Vector3()));
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		RSG::scene->render_camera(render_buffers, camera, scenario, RID(), Size2(1920, 1080), 0, 1.0, RID(), xr_interface, 1.0);
+		best_usec = MIN(best_usec, OS::get_singleton()->get_ticks_usec() - begin);
+	}
+
+	MESSAGE(vformat("Culled %d instances in %d usec (best of %d frames).", instance_count, best_usec, frames));
+
+	rs->free(camera);
+	for (const RID &instance : instances) {
+		rs->free(instance);
+	}
+	rs->free(mesh);
+	rs->free(scenario);
+}
+
+} // namespace TestRendererSceneCull
@@ -36,6 +36,8 @@ TEST_FORCE_LINK(test_navigation_server_3d)
 
 #ifdef MODULE_NAVIGATION_3D_ENABLED
 
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/main/window.h"
 #include "scene/resources/3d/primitive_meshes.h"
@@ -806,6 +808,90 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(query_result->get_path().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same results as single queries") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			for (int i = 0; i < 32; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters;
+				query_parameters.instantiate();
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(-4.0 + (i % 8), 0, -4.0));
+				query_parameters->set_target_position(Vector3(4.0, 0, -4.0 + (i / 4)));
+				// Every fourth query can't find a path, so failed queries are checked to not affect the others.
+				query_parameters->set_navigation_layers(i % 4 == 3 ? 2 : 1);
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				batch_parameters.push_back(query_parameters);
+				batch_results.push_back(query_result);
+			}
+			navigation_server->query_paths(batch_parameters, batch_results);
+
+			for (int i = 0; i < batch_parameters.size(); i++) {
+				Ref<NavigationPathQueryResult3D> single_result;
+				single_result.instantiate();
+				navigation_server->query_path(batch_parameters[i], single_result);
+				Ref<NavigationPathQueryResult3D> batch_result = batch_results[i];
+				CHECK(batch_result->get_path() == single_result->get_path());
+				CHECK(batch_result->get_path_rids() == single_result->get_path_rids());
+				CHECK_EQ(batch_result->get_path_length(), single_result->get_path_length());
+				CHECK_EQ(batch_result->get_path().is_empty(), i % 4 == 3);
+			}
+		}
+
+		navigation_server->free_rid(region);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should bake tiled navigation mesh and rebake changed tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(4.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data_tiled(navigation_mesh, source_geometry, AABB());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		const int full_bake_polygon_count = navigation_mesh->get_polygon_count();
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Path should cross tile borders") {
+			Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4.0, 0, -4.0), Vector3(4.0, 0, 4.0), true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(navigation_server->map_get_closest_point(map, Vector3(4.0, 0, 4.0))));
+		}
+
+		SUBCASE("Rebaking unchanged geometry in a changed area should yield the same navigation mesh") {
+			navigation_server->bake_from_source_geometry_data_tiled(navigation_mesh, source_geometry, AABB(Vector3(-1.0, -1.0, -1.0), Vector3(2.0, 2.0, 2.0)));
+			CHECK_EQ(navigation_mesh->get_polygon_count(), full_bake_polygon_count);
+		}
+
+		SUBCASE("Rebaking added geometry should only add to the changed tiles") {
+			Array obstacle_arr;
+			obstacle_arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(obstacle_arr, Vector3(1.0, 2.0, 1.0));
+			source_geometry->add_mesh_array(obstacle_arr, Transform3D(Basis(), Vector3(-3.0, 1.0, -3.0)));
+			navigation_server->bake_from_source_geometry_data_tiled(navigation_mesh, source_geometry, AABB(Vector3(-3.5, 0.0, -3.5), Vector3(1.0, 2.0, 1.0)));
+			CHECK_NE(navigation_mesh->get_polygon_count(), full_bake_polygon_count);
+
+			Ref<NavigationMesh> full_navigation_mesh = memnew(NavigationMesh);
+			full_navigation_mesh->set_tile_size(4.0);
+			navigation_server->bake_from_source_geometry_data_tiled(full_navigation_mesh, source_geometry, AABB());
+			CHECK_EQ(navigation_mesh->get_polygon_count(), full_navigation_mesh->get_polygon_count());
+			CHECK_EQ(navigation_mesh->get_vertices().size(), full_navigation_mesh->get_vertices().size());
+		}
+
 		navigation_server->free_rid(region);
 		navigation_server->free_rid(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
@@ -832,6 +918,70 @@ TEST_SUITE("[Navigation3D]") {
 	}
 	*/
 
+	TEST_CASE_PENDING("[NavigationServer3D][Benchmark] Query 5k paths on a large map") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		// A 256x256 floor with a grid of pillars, so paths have to go around something.
+		const real_t map_size = 256.0;
+		Array floor_arr;
+		floor_arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(floor_arr, Vector3(map_size, 0.001, map_size));
+		source_geometry->add_mesh_array(floor_arr, Transform3D());
+		Array pillar_arr;
+		pillar_arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(pillar_arr, Vector3(2.0, 4.0, 2.0));
+		for (real_t x = -map_size * 0.5 + 8.0; x < map_size * 0.5; x += 8.0) {
+			for (real_t z = -map_size * 0.5 + 8.0; z < map_size * 0.5; z += 8.0) {
+				source_geometry->add_mesh_array(pillar_arr, Transform3D(Basis(), Vector3(x, 2.0, z)));
+			}
+		}
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		REQUIRE_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const int path_count = 5000;
+		TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+		TypedArray<NavigationPathQueryResult3D> batch_results;
+		RandomPCG rng(1234);
+		for (int i = 0; i < path_count; i++) {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(rng.random(-120.0, 120.0), 0, rng.random(-120.0, 120.0)));
+			query_parameters->set_target_position(Vector3(rng.random(-120.0, 120.0), 0, rng.random(-120.0, 120.0)));
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			batch_parameters.push_back(query_parameters);
+			batch_results.push_back(query_result);
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < path_count; i++) {
+			navigation_server->query_path(batch_parameters[i], batch_results[i]);
+		}
+		uint64_t single_elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		navigation_server->query_paths(batch_parameters, batch_results);
+		uint64_t batch_elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE(vformat("Queried %d paths on %d polygons: %.3f ms one by one, %.3f ms batched.", path_count, navigation_mesh->get_polygon_count(), single_elapsed / 1000.0, batch_elapsed / 1000.0));
+
+		navigation_server->free_rid(region);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should simplify path properly") {
 		real_t simplify_epsilon = 0.2;
 		Vector<Vector3> source_path;